@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:17:17 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "../garbage_collector.h"
+# include <stddef.h>
+
+# define BENCH_MAX_PAUSES 16384
+# define BENCH_EXTRA_SIZE 8192
+
+/**
+ //! t_bench - One benchmark run, reported as one JSON object
+ //! @name: Name printed in the report and matched on the command line
+ //! @param: Per-entry argument, such as an object size or thread count
+ //! @scale: Work multiplier from the command line, 1 by default
+ //! @seconds: Wall time between bench_begin and bench_end
+ //! @ops: Operations done, the unit of ops_per_sec
+ //! @pauses: Stop-the-world pause times in milliseconds
+ //! @pause_count: Entries used in @pauses
+ //! @pause_start: Start of the pause in progress
+ //! @collections: Collections that reached the end of their sweep
+ //! @extra: Benchmark-specific JSON members, comma-separated
+ //! @extra_len: Bytes used in @extra
+ **/
+typedef struct s_bench
+{
+	const char			*name;
+	size_t				param;
+	size_t				scale;
+	double				start;
+	double				seconds;
+	size_t				ops;
+	double				pauses[BENCH_MAX_PAUSES];
+	size_t				pause_count;
+	double				pause_start;
+	size_t				collections;
+	char				extra[BENCH_EXTRA_SIZE];
+	size_t				extra_len;
+}						t_bench;
+
+typedef void			(*t_bench_fn)(t_bench *bench);
+
+/**
+ //! t_bench_node - Binary tree node, also used as a list cell
+ **/
+typedef struct s_bench_node
+{
+	struct s_bench_node	*left;
+	struct s_bench_node	*right;
+}						t_bench_node;
+
+/**
+ //! t_bench_entry - A registered benchmark
+ //! @name: Name of the run
+ //! @fn: Benchmark body, called between collector_init and collector_close
+ //! @param: Copied to t_bench.param
+ **/
+typedef struct s_bench_entry
+{
+	const char			*name;
+	t_bench_fn			fn;
+	size_t				param;
+}						t_bench_entry;
+
+// harness
+double					bench_now(void);
+void					bench_begin(t_bench *bench);
+void					bench_end(t_bench *bench, size_t ops);
+void					bench_extra(t_bench *bench, const char *key,
+							double value);
+void					bench_report(t_bench *bench);
+long					bench_rss_kb(void);
+const t_bench_entry		*bench_registry(void);
+size_t					bench_random(size_t *state);
+t_bench_node			*bench_make_tree(int depth);
+size_t					bench_check_tree(t_bench_node *node);
+t_bench_node			*bench_make_list(size_t length);
+double					bench_collect_ms(size_t count);
+
+// benchmarks
+void					bench_alloc(t_bench *bench);
+void					bench_binary_trees(t_bench *bench);
+void					bench_linked_list(t_bench *bench);
+void					bench_string_build(t_bench *bench);
+void					bench_buffers(t_bench *bench);
+void					bench_churn(t_bench *bench);
+void					bench_incremental(t_bench *bench);
+void					bench_threads(t_bench *bench);
+void					bench_mark_wide(t_bench *bench);
+void					bench_mark_deep(t_bench *bench);
+void					bench_rss(t_bench *bench);
+void					bench_compact(t_bench *bench);
+void					bench_memops(t_bench *bench);
+void					bench_byte_set(void *dst, int c, size_t n);
+void					bench_byte_copy(void *dst, const void *src, size_t n);
+int						bench_byte_cmp(const void *s1, const void *s2,
+							size_t n);
+void					*bench_byte_chr(const void *s, int c, size_t n);
+
+#endif
@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_alloc.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+//!/* 64 MiB of param-sized objects per scale unit, every 64th kept alive; */
+//!/* bytes_per_object is the heap held per retained object afterwards */
+void	bench_alloc(t_bench *bench)
+{
+	void		**keep;
+	size_t		count;
+	size_t		i;
+	t_gc_stats	stats;
+
+	count = bench->scale * ((size_t)64 << 20) / bench->param;
+	if (count < 4096)
+		count = 4096;
+	keep = gc_calloc(count / 64 + 1, sizeof(void *));
+	bench_begin(bench);
+	i = 0;
+	while (i < count)
+	{
+		keep[i / 64] = gc_malloc(bench->param);
+		i++;
+	}
+	bench_end(bench, count);
+	gc_collect();
+	gc_get_stats(&stats);
+	bench_extra(bench, "retained_objects", (double)stats.live_objects);
+	bench_extra(bench, "bytes_per_object", (double)stats.heap_bytes
+		/ (double)(stats.live_objects + (stats.live_objects == 0)));
+	bench_extra(bench, "mb_per_sec", (double)(count * bench->param)
+		/ bench->seconds / 1e6);
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_buffers.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+//!/* Fills a buffer with random words: none of them look like pointers */
+static void	fill_random(size_t *words, size_t count, size_t *rng)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < count)
+	{
+		words[i] = bench_random(rng);
+		i++;
+	}
+}
+
+//!/* Large buffers of non-pointer data; param 1 allocates them atomic so */
+//!/* the marker skips them. scan_gbps is the conservative scan rate */
+void	bench_buffers(t_bench *bench)
+{
+	void		**buffers;
+	size_t		count;
+	size_t		i;
+	size_t		rng;
+	t_gc_stats	stats;
+
+	count = bench->scale * 8;
+	rng = 88172645463325252ULL;
+	buffers = gc_calloc(count, sizeof(void *));
+	i = 0;
+	while (buffers && i < count)
+	{
+		if (bench->param == 1)
+			buffers[i] = gc_malloc_atomic((size_t)8 << 20);
+		else
+			buffers[i] = gc_malloc((size_t)8 << 20);
+		fill_random(buffers[i++], ((size_t)8 << 20) / sizeof(size_t), &rng);
+	}
+	bench_begin(bench);
+	bench_extra(bench, "collect_ms", bench_collect_ms(8));
+	bench_end(bench, 8 * count * ((size_t)8 << 20));
+	gc_get_stats(&stats);
+	bench_extra(bench, "mark_ms", (double)stats.mark_ns / 1e6);
+	bench_extra(bench, "scan_gbps", (double)(8 * count * ((size_t)8 << 20))
+		/ (double)(stats.mark_ns + (stats.mark_ns == 0)));
+}
@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_churn.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:01:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <stdlib.h>
+
+#define CHURN_SLOTS 65536
+
+//!/* The retained set lives in malloc memory, reachable only as a root */
+static void	churn(void **slots, size_t rounds, size_t *rng)
+{
+	size_t	i;
+	size_t	value;
+
+	i = 0;
+	while (i < rounds)
+	{
+		value = bench_random(rng);
+		slots[value % CHURN_SLOTS] = gc_malloc(16 + (value >> 32) % 240);
+		i++;
+	}
+}
+
+//!/* Random replacement in a fixed-size live set: param 1 sweeps lazily, */
+//!/* param 2 runs generational so most pauses are minor collections and */
+//!/* param 3 marks concurrently, trading two short pauses for one long one */
+void	bench_churn(t_bench *bench)
+{
+	void		**slots;
+	size_t		rng;
+	size_t		rounds;
+	t_gc_stats	stats;
+
+	slots = calloc(CHURN_SLOTS, sizeof(void *));
+	if (!slots)
+		return ;
+	gc_add_root(slots, CHURN_SLOTS * sizeof(void *));
+	if (bench->param == 1)
+		gc_set_lazy_sweep(1);
+	if (bench->param == 2)
+		gc_set_generational(1);
+	if (bench->param == 3)
+		gc_set_concurrent(1);
+	rng = 0x2545f4914f6cdd1d;
+	rounds = bench->scale << 22;
+	bench_begin(bench);
+	churn(slots, rounds, &rng);
+	bench_end(bench, rounds);
+	gc_get_stats(&stats);
+	bench_extra(bench, "minor_collections", (double)stats.minor_collections);
+	gc_remove_root(slots);
+	free(slots);
+}
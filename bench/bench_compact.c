@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_compact.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:17:17 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:17:17 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+#define COMPACT_GAP 16
+#define COMPACT_WALKS 8
+
+//!/* Every kept cell is followed by COMPACT_GAP - 1 dropped ones, so the */
+//!/* survivors end up spread thin over the pages */
+static t_bench_node	*make_sparse(size_t length)
+{
+	t_gc_layout		layout;
+	t_bench_node	*head;
+	t_bench_node	*last;
+	t_bench_node	*cell;
+	size_t			i;
+
+	layout.bitmap = 3;
+	layout.words = 2;
+	head = NULL;
+	last = NULL;
+	i = 0;
+	while (i < length * COMPACT_GAP)
+	{
+		cell = gc_malloc_typed(sizeof(t_bench_node), &layout);
+		if (!cell)
+			return (NULL);
+		if (i % COMPACT_GAP == 0 && last)
+			last->left = cell;
+		else if (i % COMPACT_GAP == 0)
+			head = cell;
+		if (i % COMPACT_GAP == 0)
+			last = cell;
+		i++;
+	}
+	return (head);
+}
+
+static double	walk_ms(t_bench_node *head, size_t *seen)
+{
+	t_bench_node	*cell;
+	double			start;
+	size_t			round;
+
+	start = bench_now();
+	*seen = 0;
+	round = 0;
+	while (round < COMPACT_WALKS)
+	{
+		cell = head;
+		while (cell)
+		{
+			(*seen)++;
+			cell = cell->left;
+		}
+		round++;
+	}
+	return ((bench_now() - start) * 1e3 / COMPACT_WALKS);
+}
+
+//!/* Resident set, traversal and collection times of a list left sparse */
+//!/* by its dropped neighbours, before and after a compacting collection */
+void	bench_compact(t_bench *bench)
+{
+	t_bench_node	*head;
+	t_gc_stats		stats;
+	size_t			seen;
+
+	bench_begin(bench);
+	gc_disable();
+	head = make_sparse(bench->scale << 16);
+	gc_enable();
+	gc_collect();
+	bench_extra(bench, "rss_before_kb", (double)bench_rss_kb());
+	bench_extra(bench, "walk_before_ms", walk_ms(head, &seen));
+	bench_extra(bench, "collect_before_ms", bench_collect_ms(2));
+	gc_set_compaction(1);
+	gc_collect();
+	gc_set_compaction(0);
+	bench_extra(bench, "rss_after_kb", (double)bench_rss_kb());
+	bench_extra(bench, "walk_after_ms", walk_ms(head, &seen));
+	bench_extra(bench, "collect_after_ms", bench_collect_ms(2));
+	gc_get_stats(&stats);
+	bench_extra(bench, "moved_objects", (double)stats.moved_objects);
+	bench_extra(bench, "evacuated_pages", (double)stats.evacuated_pages);
+	bench_end(bench, seen / COMPACT_WALKS);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_graph.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+t_bench_node	*bench_make_tree(int depth)
+{
+	t_bench_node	*node;
+
+	node = gc_malloc(sizeof(t_bench_node));
+	if (!node)
+		return (NULL);
+	node->left = NULL;
+	node->right = NULL;
+	if (depth > 0)
+	{
+		node->left = bench_make_tree(depth - 1);
+		node->right = bench_make_tree(depth - 1);
+	}
+	return (node);
+}
+
+size_t	bench_check_tree(t_bench_node *node)
+{
+	if (!node)
+		return (0);
+	return (1 + bench_check_tree(node->left) + bench_check_tree(node->right));
+}
+
+//!/* Cells are linked through left; right stays NULL */
+t_bench_node	*bench_make_list(size_t length)
+{
+	t_bench_node	*head;
+	t_bench_node	*cell;
+
+	head = NULL;
+	while (length-- > 0)
+	{
+		cell = gc_malloc(sizeof(t_bench_node));
+		if (!cell)
+			return (head);
+		cell->left = head;
+		cell->right = NULL;
+		head = cell;
+	}
+	return (head);
+}
+
+//!/* Mean duration of count explicit collections, in milliseconds */
+double	bench_collect_ms(size_t count)
+{
+	double	start;
+	size_t	i;
+
+	start = bench_now();
+	i = 0;
+	while (i < count)
+	{
+		gc_collect();
+		i++;
+	}
+	return ((bench_now() - start) * 1e3 / (double)count);
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_harness.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:01:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <stdio.h>
+#include <time.h>
+
+double	bench_now(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((double)now.tv_sec + (double)now.tv_nsec / 1e9);
+}
+
+//!/* A pause is the time the world stays stopped: once per collection, */
+//!/* twice for a concurrent one */
+static void	on_event(t_gc_event event, void *arg)
+{
+	t_bench	*bench;
+
+	bench = arg;
+	if (event == GC_EVENT_SWEEP_END)
+		bench->collections++;
+	else if (event == GC_EVENT_PAUSE_BEGIN)
+		bench->pause_start = bench_now();
+	else if (event == GC_EVENT_PAUSE_END
+		&& bench->pause_count < BENCH_MAX_PAUSES)
+		bench->pauses[bench->pause_count++]
+			= (bench_now() - bench->pause_start) * 1e3;
+}
+
+//!/* Setup done before bench_begin is neither timed nor counted */
+void	bench_begin(t_bench *bench)
+{
+	bench->pause_count = 0;
+	bench->collections = 0;
+	gc_set_event_callback(on_event, bench);
+	bench->start = bench_now();
+}
+
+void	bench_end(t_bench *bench, size_t ops)
+{
+	bench->seconds = bench_now() - bench->start;
+	bench->ops = ops;
+	gc_set_event_callback(NULL, NULL);
+}
+
+void	bench_extra(t_bench *bench, const char *key, double value)
+{
+	int	written;
+
+	written = snprintf(bench->extra + bench->extra_len,
+			BENCH_EXTRA_SIZE - bench->extra_len, ",\n    \"%s\": %.6g",
+			key, value);
+	if (written > 0
+		&& bench->extra_len + (size_t)written < BENCH_EXTRA_SIZE)
+		bench->extra_len += (size_t)written;
+}
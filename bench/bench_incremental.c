@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_incremental.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:35:01 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:46:23 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+#define INCREMENTAL_SLOTS 65536
+#define INCREMENTAL_FRAME 512
+#define INCREMENTAL_BUDGET_US 1000
+
+//!/* One frame of an event loop: a run of the retained set is replaced, */
+//!/* the slots being a collected block the barrier has to hear about */
+static void	run_frame(void **slots, size_t *rng, int barrier)
+{
+	size_t	i;
+	size_t	value;
+	size_t	slot;
+
+	slot = bench_random(rng) % INCREMENTAL_SLOTS;
+	i = 0;
+	while (i < INCREMENTAL_FRAME)
+	{
+		value = bench_random(rng);
+		slot = (slot + 1) % INCREMENTAL_SLOTS;
+		slots[slot] = gc_malloc(16 + (value >> 32) % 240);
+		if (barrier)
+			gc_write_barrier(slots, &slots[slot]);
+		i++;
+	}
+}
+
+//!/* stats gets the longest step, their sum, the steps over twice the */
+//!/* budget and the collections completed, all times in milliseconds */
+static void	step_loop(t_bench *bench, void **slots, size_t frames,
+		double *stats)
+{
+	size_t	frame;
+	size_t	rng;
+	double	start;
+	double	elapsed;
+
+	rng = 0x2545f4914f6cdd1d;
+	frame = 0;
+	while (frame < frames)
+	{
+		run_frame(slots, &rng, bench->param == 1);
+		start = bench_now();
+		if (!gc_collect_step(INCREMENTAL_BUDGET_US))
+			stats[3] += 1.0;
+		elapsed = (bench_now() - start) * 1e3;
+		if (elapsed > stats[0])
+			stats[0] = elapsed;
+		stats[1] += elapsed;
+		if (elapsed > 2.0 * INCREMENTAL_BUDGET_US / 1e3)
+			stats[2] += 1.0;
+		frame++;
+	}
+}
+
+//!/* Only gc_collect_step collects: param 1 reports stores through the */
+//!/* write barrier instead of write-protecting the heap during a mark */
+void	bench_incremental(t_bench *bench)
+{
+	void	**slots;
+	size_t	frames;
+	double	stats[4];
+
+	gc_set_write_barrier(bench->param == 1);
+	slots = gc_calloc(INCREMENTAL_SLOTS, sizeof(void *));
+	if (!slots)
+		return ;
+	stats[0] = 0.0;
+	stats[1] = 0.0;
+	stats[2] = 0.0;
+	stats[3] = 0.0;
+	frames = bench->scale << 12;
+	gc_disable();
+	bench_begin(bench);
+	step_loop(bench, slots, frames, stats);
+	bench_end(bench, frames);
+	gc_enable();
+	bench_extra(bench, "budget_ms", INCREMENTAL_BUDGET_US / 1e3);
+	bench_extra(bench, "step_max_ms", stats[0]);
+	bench_extra(bench, "step_mean_ms", stats[1] / (double)frames);
+	bench_extra(bench, "steps_over_twice_budget", stats[2]);
+	bench_extra(bench, "cycles", stats[3]);
+}
@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_list.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+//!/* A single long list: the deepest graph the mark stack has to follow */
+void	bench_linked_list(t_bench *bench)
+{
+	t_bench_node	*head;
+	t_bench_node	*cell;
+	size_t			length;
+	size_t			seen;
+
+	length = bench->scale << 21;
+	bench_begin(bench);
+	head = bench_make_list(length);
+	bench_extra(bench, "collect_ms", bench_collect_ms(4));
+	seen = 0;
+	cell = head;
+	while (cell)
+	{
+		seen++;
+		cell = cell->left;
+	}
+	if (seen != length)
+		length = 0;
+	bench_end(bench, length);
+}
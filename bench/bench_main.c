@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_main.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:38 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+//!/* collector_init gets a local of this frame: the benchmark runs below */
+__attribute__((noinline))
+static void	run_child(const t_bench_entry *entry, size_t scale)
+{
+	t_bench	bench;
+
+	memset(&bench, 0, sizeof(bench));
+	collector_init(&bench);
+	bench.name = entry->name;
+	bench.param = entry->param;
+	bench.scale = scale;
+	entry->fn(&bench);
+	bench_report(&bench);
+	collector_close();
+}
+
+//!/* No name selects everything; otherwise any name prefix matches */
+static int	selected(const char *name, int argc, char **argv, int first)
+{
+	int	i;
+
+	if (first >= argc)
+		return (1);
+	i = first;
+	while (i < argc)
+	{
+		if (strncmp(name, argv[i], strlen(argv[i])) == 0)
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+//!/* Every benchmark gets a fresh process, collector and peak RSS. One */
+//!/* that can't start, crashes or exits non-zero is reported as failed */
+static int	run_one(const t_bench_entry *entry, size_t scale, int *count)
+{
+	pid_t	pid;
+	int		status;
+
+	if (*count)
+		printf(",\n");
+	else
+		printf("[\n");
+	fflush(stdout);
+	pid = fork();
+	if (pid == 0)
+	{
+		run_child(entry, scale);
+		exit(0);
+	}
+	(*count)++;
+	if (pid > 0 && waitpid(pid, &status, 0) >= 0 && WIFEXITED(status)
+		&& WEXITSTATUS(status) == 0)
+		return (1);
+	printf("  {\"name\": \"%s\", \"failed\": true}", entry->name);
+	fprintf(stderr, "%s: failed\n", entry->name);
+	return (0);
+}
+
+//!/* Returns the index of the first name argument */
+static int	parse_scale(int argc, char **argv, size_t *scale)
+{
+	*scale = 1;
+	if (argc < 3 || strcmp(argv[1], "-s") != 0)
+		return (1);
+	*scale = strtoul(argv[2], NULL, 10);
+	if (*scale == 0)
+		*scale = 1;
+	return (3);
+}
+
+//!/* usage: gc_bench [-s scale] [name-prefix ...], JSON on stdout. Exits */
+//!/* with 1 if any benchmark failed, once the others have run */
+int	main(int argc, char **argv)
+{
+	const t_bench_entry	*entry;
+	size_t				scale;
+	int					first;
+	int					count;
+	int					failed;
+
+	first = parse_scale(argc, argv, &scale);
+	entry = bench_registry();
+	count = 0;
+	failed = 0;
+	while (entry->name)
+	{
+		if (selected(entry->name, argc, argv, first)
+			&& !run_one(entry, scale, &count))
+			failed++;
+		entry++;
+	}
+	if (count == 0)
+		printf("[");
+	printf("\n]\n");
+	return (failed != 0);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_mark.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <string.h>
+
+#define WIDE_TREES 256
+
+//!/* Many independent subtrees: work the markers can share */
+void	bench_mark_wide(t_bench *bench)
+{
+	t_bench_node	**roots;
+	size_t			i;
+	size_t			trees;
+
+	gc_set_mark_threads(bench->param);
+	trees = WIDE_TREES * bench->scale;
+	roots = gc_calloc(trees, sizeof(t_bench_node *));
+	i = 0;
+	while (roots && i < trees)
+	{
+		roots[i] = bench_make_tree(12);
+		i++;
+	}
+	bench_begin(bench);
+	bench_extra(bench, "collect_ms", bench_collect_ms(8));
+	bench_end(bench, 8 * trees * (((size_t)1 << 13) - 1));
+}
+
+//!/* A few long chains: little parallelism for the markers to find */
+void	bench_mark_deep(t_bench *bench)
+{
+	t_bench_node	*chains[4];
+	size_t			length;
+	size_t			i;
+
+	gc_set_mark_threads(bench->param);
+	length = bench->scale << 19;
+	i = 0;
+	while (i < 4)
+	{
+		chains[i] = bench_make_list(length);
+		i++;
+	}
+	bench_begin(bench);
+	bench_extra(bench, "collect_ms", bench_collect_ms(8));
+	bench_end(bench, 8 * 4 * length);
+	memset(chains, 0, sizeof(chains));
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_memops.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:10 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include "../internal_collector.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MEMOPS_MAX ((size_t)64 << 20)
+#define MEMOPS_BYTES ((size_t)32 << 20)
+
+//!/* op picks the primitive, impl the implementation; equal buffers and a */
+//!/* missing byte make memcmp and memchr read all n bytes. Returns what */
+//!/* the compare and search found, 0 for the others */
+static size_t	run_op(int op, int impl, unsigned char **buf, size_t n)
+{
+	if (op == 0 && impl == 0)
+		gc_memset(buf[0], 0, n);
+	else if (op == 0 && impl == 1)
+		bench_byte_set(buf[0], 0, n);
+	else if (op == 0)
+		memset(buf[0], 0, n);
+	else if (op == 1 && impl == 0)
+		gc_memcpy(buf[0], buf[1], n);
+	else if (op == 1 && impl == 1)
+		bench_byte_copy(buf[0], buf[1], n);
+	else if (op == 1)
+		memcpy(buf[0], buf[1], n);
+	else if (op == 2 && impl == 0)
+		return (gc_memcmp(buf[0], buf[1], n) != 0);
+	else if (op == 2 && impl == 1)
+		return (bench_byte_cmp(buf[0], buf[1], n) != 0);
+	else if (op == 2)
+		return (memcmp(buf[0], buf[1], n) != 0);
+	else if (impl == 0)
+		return (gc_memchr(buf[0], 1, n) != NULL);
+	else if (impl == 1)
+		return (bench_byte_chr(buf[0], 1, n) != NULL);
+	else
+		return (memchr(buf[0], 1, n) != NULL);
+	return (0);
+}
+
+//!/* Stores GB/s under a key such as memcpy_gc_4096 */
+static void	record(t_bench *bench, int kind, size_t size, double gbps)
+{
+	const char	*ops[4];
+	const char	*impls[3];
+	char		key[64];
+
+	ops[0] = "memset";
+	ops[1] = "memcpy";
+	ops[2] = "memcmp";
+	ops[3] = "memchr";
+	impls[0] = "gc";
+	impls[1] = "byte";
+	impls[2] = "libc";
+	snprintf(key, sizeof(key), "%s_%s_%zu", ops[kind / 3], impls[kind % 3],
+		size);
+	bench_extra(bench, key, gbps);
+}
+
+//!/* kind is op * 3 + impl; every case moves about 32 MiB per scale unit. */
+//!/* The empty asm takes each result and may read or write any memory, */
+//!/* so no call is folded or hoisted out of the loop */
+static void	measure(t_bench *bench, int kind, unsigned char **buf,
+	size_t size)
+{
+	size_t	reps;
+	size_t	i;
+	size_t	found;
+	double	start;
+
+	reps = MEMOPS_BYTES * bench->scale / size;
+	if (reps == 0)
+		reps = 1;
+	start = bench_now();
+	i = 0;
+	while (i < reps)
+	{
+		found = run_op(kind / 3, kind % 3, buf, size);
+		__asm__ volatile ("" : : "r"(found) : "memory");
+		i++;
+	}
+	record(bench, kind, size, (double)(reps * size)
+		/ ((bench_now() - start) * 1e9));
+}
+
+//!/* Sizes run from 8 B to 64 MiB; buffers come from libc so the collector */
+//!/* never scans them, and are written once so that no case pays for */
+//!/* faulting their pages in */
+void	bench_memops(t_bench *bench)
+{
+	unsigned char	*buf[2];
+	size_t			sizes[8];
+	int				s;
+	int				kind;
+
+	buf[0] = malloc(MEMOPS_MAX);
+	buf[1] = malloc(MEMOPS_MAX);
+	s = -1;
+	while (buf[0] && buf[1] && ++s < 2)
+		memset(buf[s], 0, MEMOPS_MAX);
+	s = -1;
+	while (++s < 7)
+		sizes[s] = (size_t)8 << (3 * s);
+	sizes[7] = MEMOPS_MAX;
+	bench_begin(bench);
+	s = -1;
+	while (buf[0] && buf[1] && ++s < 8)
+	{
+		kind = -1;
+		while (++kind < 12)
+			measure(bench, kind, buf, sizes[s]);
+	}
+	bench_end(bench, 8 * 12);
+	free(buf[0]);
+	free(buf[1]);
+}
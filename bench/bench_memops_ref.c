@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_memops_ref.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+//!/* The byte-at-a-time loops the gc_mem* primitives replaced. volatile */
+//!/* keeps the compiler from turning them back into library calls */
+void	bench_byte_set(void *dst, int c, size_t n)
+{
+	volatile unsigned char	*d;
+
+	d = dst;
+	while (n-- > 0)
+		*d++ = (unsigned char)c;
+}
+
+void	bench_byte_copy(void *dst, const void *src, size_t n)
+{
+	volatile unsigned char	*d;
+	const unsigned char		*s;
+
+	d = dst;
+	s = src;
+	while (n-- > 0)
+		*d++ = *s++;
+}
+
+int	bench_byte_cmp(const void *s1, const void *s2, size_t n)
+{
+	const volatile unsigned char	*a;
+	const volatile unsigned char	*b;
+
+	a = s1;
+	b = s2;
+	while (n-- > 0)
+	{
+		if (*a != *b)
+			return (*a - *b);
+		a++;
+		b++;
+	}
+	return (0);
+}
+
+void	*bench_byte_chr(const void *s, int c, size_t n)
+{
+	const volatile unsigned char	*p;
+
+	p = s;
+	while (n-- > 0)
+	{
+		if (*p == (unsigned char)c)
+			return ((void *)p);
+		p++;
+	}
+	return (NULL);
+}
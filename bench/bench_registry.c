@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_registry.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:17:17 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+//!/* Params: object size, thread count, mark threads, or a mode flag */
+const t_bench_entry	*bench_registry(void)
+{
+	static const t_bench_entry	entries[] = {
+	{"alloc_16", bench_alloc, 16}, {"alloc_64", bench_alloc, 64},
+	{"alloc_256", bench_alloc, 256}, {"alloc_1024", bench_alloc, 1024},
+	{"alloc_4096", bench_alloc, 4096}, {"alloc_65536", bench_alloc, 65536},
+	{"alloc_1048576", bench_alloc, 1048576},
+	{"binary_trees", bench_binary_trees, 0},
+	{"binary_trees_interior", bench_binary_trees, 1},
+	{"binary_trees_concurrent", bench_binary_trees, 2},
+	{"linked_list", bench_linked_list, 0}, {"compact", bench_compact, 0},
+	{"string_build", bench_string_build, 0},
+	{"buffers", bench_buffers, 0}, {"buffers_atomic", bench_buffers, 1},
+	{"churn", bench_churn, 0}, {"churn_lazy", bench_churn, 1},
+	{"churn_generational", bench_churn, 2},
+	{"churn_concurrent", bench_churn, 3},
+	{"incremental", bench_incremental, 0},
+	{"incremental_barrier", bench_incremental, 1},
+	{"threads_1", bench_threads, 1}, {"threads_2", bench_threads, 2},
+	{"threads_4", bench_threads, 4}, {"threads_8", bench_threads, 8},
+	{"mark_wide_1", bench_mark_wide, 1}, {"mark_wide_2", bench_mark_wide, 2},
+	{"mark_wide_4", bench_mark_wide, 4}, {"mark_wide_8", bench_mark_wide, 8},
+	{"mark_deep_1", bench_mark_deep, 1}, {"mark_deep_2", bench_mark_deep, 2},
+	{"mark_deep_4", bench_mark_deep, 4}, {"mark_deep_8", bench_mark_deep, 8},
+	{"rss_trim", bench_rss, 0}, {"memops", bench_memops, 0}, {NULL, NULL, 0}};
+
+	return (entries);
+}
+
+//!/* xorshift64: cheap, deterministic, and good enough for workloads */
+size_t	bench_random(size_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return (*state);
+}
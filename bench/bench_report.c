@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:01:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+
+static int	compare_doubles(const void *a, const void *b)
+{
+	double	x;
+	double	y;
+
+	x = *(const double *)a;
+	y = *(const double *)b;
+	return ((x > y) - (x < y));
+}
+
+//!/* Nearest-rank percentile of the sorted pauses */
+static double	percentile(const t_bench *bench, double rank)
+{
+	size_t	index;
+
+	if (bench->pause_count == 0)
+		return (0.0);
+	index = (size_t)(rank * (double)(bench->pause_count - 1) + 0.5);
+	return (bench->pauses[index]);
+}
+
+//!/* Current resident set, from /proc; 0 where it is not available */
+long	bench_rss_kb(void)
+{
+	FILE	*file;
+	long	size;
+	long	resident;
+
+	file = fopen("/proc/self/statm", "r");
+	if (!file)
+		return (0);
+	resident = 0;
+	if (fscanf(file, "%ld %ld", &size, &resident) != 2)
+		resident = 0;
+	fclose(file);
+	return (resident * 4);
+}
+
+static void	print_pauses(const t_bench *bench)
+{
+	printf("    \"collections\": %zu,\n", bench->collections);
+	printf("    \"pauses\": %zu,\n", bench->pause_count);
+	printf("    \"pause_ms\": {\"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, "
+		"\"max\": %.4f},\n", percentile(bench, 0.5), percentile(bench, 0.9),
+		percentile(bench, 0.99), percentile(bench, 1.0));
+}
+
+//!/* ru_maxrss is in KiB on Linux; each run is its own process */
+void	bench_report(t_bench *bench)
+{
+	struct rusage	usage;
+	double			rate;
+
+	qsort(bench->pauses, bench->pause_count, sizeof(double),
+		compare_doubles);
+	getrusage(RUSAGE_SELF, &usage);
+	rate = 0.0;
+	if (bench->seconds > 0.0)
+		rate = (double)bench->ops / bench->seconds;
+	printf("  {\n    \"name\": \"%s\",\n", bench->name);
+	printf("    \"seconds\": %.6f,\n    \"ops\": %zu,\n", bench->seconds,
+		bench->ops);
+	printf("    \"ops_per_sec\": %.1f,\n", rate);
+	print_pauses(bench);
+	printf("    \"peak_rss_kb\": %ld%.*s\n  }", usage.ru_maxrss,
+		(int)bench->extra_len, bench->extra);
+	fprintf(stderr, "%-24s %12.0f ops/s  p99 %8.3f ms  rss %8ld KiB\n",
+		bench->name, rate, percentile(bench, 0.99), usage.ru_maxrss);
+}
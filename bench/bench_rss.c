@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_rss.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <string.h>
+
+#define RSS_BLOCKS 64
+#define RSS_SMALL 262144
+
+//!/* Touched large blocks and small objects, then everything but 1% drops */
+static void	populate(void **blocks, void **small, size_t scale)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < RSS_BLOCKS * scale)
+	{
+		blocks[i] = gc_malloc_atomic((size_t)1 << 20);
+		if (blocks[i])
+			memset(blocks[i], 0x5a, (size_t)1 << 20);
+		i++;
+	}
+	i = 0;
+	while (i < RSS_SMALL)
+	{
+		small[i % 1024] = gc_malloc(64);
+		if (small[i % 1024])
+			memset(small[i % 1024], 0x5a, 64);
+		i++;
+	}
+}
+
+//!/* Resident set before and after collecting, and after gc_trim */
+void	bench_rss(t_bench *bench)
+{
+	void	**blocks;
+	void	**small;
+	size_t	trimmed;
+
+	blocks = gc_calloc(RSS_BLOCKS * bench->scale, sizeof(void *));
+	small = gc_calloc(1024, sizeof(void *));
+	if (!blocks || !small)
+		return ;
+	bench_begin(bench);
+	populate(blocks, small, bench->scale);
+	bench_extra(bench, "rss_full_kb", (double)bench_rss_kb());
+	memset(blocks, 0, RSS_BLOCKS * bench->scale * sizeof(void *));
+	gc_collect();
+	bench_extra(bench, "rss_collected_kb", (double)bench_rss_kb());
+	trimmed = gc_trim();
+	bench_extra(bench, "rss_trimmed_kb", (double)bench_rss_kb());
+	bench_extra(bench, "trimmed_bytes", (double)trimmed);
+	bench_end(bench, 1);
+}
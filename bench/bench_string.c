@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_string.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <string.h>
+
+//!/* Naive append loop: one gc_realloc per chunk, counting moved bytes */
+static void	build_one(size_t *rng, size_t target, size_t *copied,
+	size_t *moves)
+{
+	char	*str;
+	char	*grown;
+	size_t	len;
+	size_t	chunk;
+
+	str = NULL;
+	len = 0;
+	while (len < target)
+	{
+		chunk = 1 + bench_random(rng) % 48;
+		grown = gc_realloc(str, len + chunk + 1);
+		if (!grown)
+			return ;
+		if (str && grown != str)
+		{
+			*copied += len;
+			(*moves)++;
+		}
+		memset(grown + len, 'a' + (int)(chunk % 26), chunk);
+		len += chunk;
+		grown[len] = '\0';
+		str = grown;
+	}
+}
+
+void	bench_string_build(t_bench *bench)
+{
+	size_t		rng;
+	size_t		copied;
+	size_t		moves;
+	size_t		i;
+	t_gc_stats	stats;
+
+	rng = 0x9e3779b97f4a7c15;
+	copied = 0;
+	moves = 0;
+	bench_begin(bench);
+	i = 0;
+	while (i < bench->scale * 256)
+	{
+		build_one(&rng, (size_t)256 << (i % 10), &copied, &moves);
+		i++;
+	}
+	bench_end(bench, i);
+	gc_get_stats(&stats);
+	bench_extra(bench, "bytes_copied", (double)copied);
+	bench_extra(bench, "moves", (double)moves);
+	bench_extra(bench, "peak_heap_bytes", (double)stats.peak_heap_bytes);
+}
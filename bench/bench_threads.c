@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_threads.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+#include <pthread.h>
+
+#define THREAD_SLOTS 1024
+#define THREAD_ROUNDS 524288
+
+//!/* Each worker keeps a small live set on its own stack */
+static void	*worker(void *arg)
+{
+	void	*slots[THREAD_SLOTS];
+	size_t	rng;
+	size_t	i;
+	size_t	value;
+
+	gc_register_thread(&slots[THREAD_SLOTS - 1] + 1);
+	rng = (size_t)arg * 0x9e3779b97f4a7c15 + 1;
+	i = 0;
+	while (i < THREAD_SLOTS)
+		slots[i++] = NULL;
+	i = 0;
+	while (i < THREAD_ROUNDS)
+	{
+		value = bench_random(&rng);
+		slots[value % THREAD_SLOTS] = gc_malloc(16 + (value >> 40) % 112);
+		i++;
+	}
+	gc_unregister_thread();
+	return (NULL);
+}
+
+//!/* param workers allocate concurrently, a fixed amount each */
+void	bench_threads(t_bench *bench)
+{
+	pthread_t	threads[64];
+	size_t		started;
+	size_t		i;
+
+	bench_begin(bench);
+	started = 0;
+	while (started < bench->param && started < 64)
+	{
+		if (pthread_create(&threads[started], NULL, worker,
+				(void *)(started + 1)) != 0)
+			break ;
+		started++;
+	}
+	i = 0;
+	while (i < started)
+		pthread_join(threads[i++], NULL);
+	bench_end(bench, started * THREAD_ROUNDS);
+}
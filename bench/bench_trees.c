@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_trees.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:01:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+//!/* GCBench-style: a long-lived tree of max_depth stays reachable while */
+//!/* many short-lived trees of growing depth are built and checked */
+static size_t	churn_trees(size_t scale, int max_depth)
+{
+	size_t	nodes;
+	size_t	iterations;
+	size_t	i;
+	int		depth;
+
+	nodes = 0;
+	depth = 4;
+	while (depth <= max_depth)
+	{
+		iterations = scale << (max_depth - depth + 2);
+		i = 0;
+		while (i < iterations)
+		{
+			nodes += bench_check_tree(bench_make_tree(depth));
+			i++;
+		}
+		depth += 2;
+	}
+	return (nodes);
+}
+
+//!/* param 1 runs with interior pointers recognised, to compare mark time; */
+//!/* param 2 marks concurrently */
+void	bench_binary_trees(t_bench *bench)
+{
+	t_bench_node	*long_lived;
+	size_t			nodes;
+	t_gc_stats		stats;
+
+	gc_set_interior_pointers(bench->param == 1);
+	gc_set_concurrent(bench->param == 2);
+	bench_begin(bench);
+	long_lived = bench_make_tree(16);
+	nodes = churn_trees(bench->scale, 16);
+	if (bench_check_tree(long_lived) != ((size_t)1 << 17) - 1)
+		nodes = 0;
+	bench_end(bench, nodes);
+	gc_get_stats(&stats);
+	bench_extra(bench, "mark_ms", (double)stats.mark_ns / 1e6);
+	bench_extra(bench, "sweep_ms", (double)stats.sweep_ns / 1e6);
+	bench_extra(bench, "mark_ms_per_collection", (double)stats.mark_ns / 1e6
+		/ (double)(stats.collections + (stats.collections == 0)));
+}
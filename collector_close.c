@@ -6,25 +6,21 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 20:46:45 by harici            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+
 #include "internal_collector.h"
 
+//!/* Every other thread must have called gc_unregister_thread already, */
+//!/* and every instance made by gc_create must be destroyed */
 void	collector_close(void)
 {
-	t_collecter	**head_ptr;
-	t_collecter	*current;
-	t_collecter	*next;
-
-	head_ptr = get_gc_head();
-	current = *head_ptr;
-	while (current)
-	{
-		next = current->next;
-		free(current);
-		current = next;
-	}
-	*head_ptr = NULL;
+	gc_concurrent_thread_stop();
+	gc_unregister_thread();
+	gc_lock();
+	gc_instance_release();
+	gc_protect_uninstall();
+	gc_unlock();
 }
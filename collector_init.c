@@ -6,15 +6,18 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 17:30:39 by akivam            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 23:37:09 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "internal_collector.h"
 
+//!/* The calling thread is registered; others call gc_register_thread */
+//!/* GC_LOG set to anything but 0 turns the per-collection log on */
 void	collector_init(void *stack_start)
 {
 	void	**stack_ptr;
+	char	*log;
 
 	if (!stack_start)
 		return ;
@@ -22,4 +25,7 @@ void	collector_init(void *stack_start)
 	if (!stack_ptr)
 		return ;
 	*stack_ptr = stack_start;
+	log = getenv("GC_LOG");
+	get_gc_config()->log = (log && *log && !(log[0] == '0' && !log[1]));
+	gc_register_thread(stack_start);
 }
@@ -6,7 +6,7 @@
 /*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 16:57:17 by akivam            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 02:21:13 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,14 +15,138 @@
 
 # include <stddef.h>
 
+# define GC_STATS_BUCKETS 16
+# define GC_PROFILE_RATE 524288
+# define GC_DUMP_MAGIC 0x3130504d55444347UL
+# define GC_DUMP_END 0
+# define GC_DUMP_SITE 1
+# define GC_DUMP_OBJECT 2
+# define GC_DUMP_EDGE 3
+# define GC_DUMP_MAPS 4
+
 typedef struct s_collecter
 {
 	unsigned char		is_marked;
+	unsigned char		flags;
+	unsigned char		dirty;
 	size_t				size;
+	size_t				mapped;
+	unsigned char		*cards;
 	struct s_collecter	*next;
+	struct s_collecter	*prev;
 
 }						t_collecter;
 
+/**
+ //! t_gc_policy - When allocations trigger a collection
+ //! @min_heap: Bytes that may always be allocated between two cycles
+ //! @growth_factor: Collect once the bytes allocated since the last cycle
+ //!                 reach this multiple of the bytes that survived it,
+ //!                 or @min_heap if that is larger
+ //! @max_heap: Hard heap limit in bytes, 0 for no limit
+ **/
+typedef struct s_gc_policy
+{
+	size_t				min_heap;
+	double				growth_factor;
+	size_t				max_heap;
+}						t_gc_policy;
+
+/**
+ //! t_gc_layout - Which words of a typed object hold pointers
+ //! @bitmap: Bit i is set when word i of an element holds a pointer
+ //! @words: Element size in words, 1 to 64; arrays repeat the layout
+ **/
+typedef struct s_gc_layout
+{
+	unsigned long		bitmap;
+	size_t				words;
+}						t_gc_layout;
+
+/**
+ //! t_gc_stats - Collector counters, see gc_get_stats
+ //! @collections: Collections run, minor ones included
+ //! @minor_collections: Collections that traced young objects only
+ //! @mark_ns: Time spent marking, in nanoseconds
+ //! @sweep_ns: Time spent sweeping, gc_sweep_step calls included
+ //! @last_mark_ns: Duration of the last mark
+ //! @last_sweep_ns: Sweep time of the last gc_collect, setup only if lazy
+ //! @max_pause_ns: Longest collection, concurrent marking included
+ //! @heap_bytes: Memory currently held for objects, pages and large blocks
+ //! @peak_heap_bytes: Largest @heap_bytes seen
+ //! @live_bytes: Bytes that survived the last collection
+ //! @live_objects: Objects that survived the last collection
+ //! @freed_bytes: Bytes freed by every sweep and gc_free so far
+ //! @freed_objects: Objects freed by every sweep and gc_free so far
+ //! @allocs: Allocation counts by size: bucket i holds sizes up to
+ //!          16 << i bytes, the last bucket everything larger
+ //! @near_misses: Words of the last mark that looked like heap addresses
+ //!               but hit no object
+ //! @false_refs: Estimated references of the last mark that hit an
+ //!              object by chance and kept it alive
+ //! @pauses: Stop-the-world pauses, two per concurrent collection
+ //! @stop_ns: Time the world spent stopped
+ //! @max_stop_ns: Longest stop-the-world pause
+ //! @region_chunks: Region chunks returned whole to the kernel
+ //! @promoted_chunks: Region chunks moved to the heap because something
+ //!                   outside the region still referenced them
+ //! @moved_objects: Objects moved by compaction
+ //! @evacuated_pages: Pages compaction emptied and released
+ **/
+typedef struct s_gc_stats
+{
+	size_t				collections;
+	size_t				minor_collections;
+	unsigned long long	mark_ns;
+	unsigned long long	sweep_ns;
+	unsigned long long	last_mark_ns;
+	unsigned long long	last_sweep_ns;
+	unsigned long long	max_pause_ns;
+	size_t				heap_bytes;
+	size_t				peak_heap_bytes;
+	size_t				live_bytes;
+	size_t				live_objects;
+	size_t				freed_bytes;
+	size_t				freed_objects;
+	size_t				allocs[GC_STATS_BUCKETS];
+	size_t				near_misses;
+	size_t				false_refs;
+	size_t				pauses;
+	unsigned long long	stop_ns;
+	unsigned long long	max_stop_ns;
+	size_t				region_chunks;
+	size_t				promoted_chunks;
+	size_t				moved_objects;
+	size_t				evacuated_pages;
+}						t_gc_stats;
+
+/**
+ //! t_gc_event - Phases reported to the callback of gc_set_event_callback
+ **/
+typedef enum e_gc_event
+{
+	GC_EVENT_MARK_BEGIN,
+	GC_EVENT_MARK_END,
+	GC_EVENT_SWEEP_BEGIN,
+	GC_EVENT_SWEEP_END,
+	GC_EVENT_PAUSE_BEGIN,
+	GC_EVENT_PAUSE_END
+}						t_gc_event;
+
+typedef void			(*t_gc_event_fn)(t_gc_event event, void *arg);
+
+/**
+ //! gc_t - An independent collector with a heap of its own
+ **/
+typedef struct s_gc_instance	gc_t;
+
+/**
+ //! gc_weak_t - A reference that doesn't keep its target alive
+ **/
+typedef struct s_gc_weak		gc_weak_t;
+
+typedef void			(*t_gc_finalizer)(void *obj);
+
 void					collector_init(void *stack_start);
 void					collector_close(void);
 void					gc_collect(void);
@@ -45,9 +169,503 @@ void					*gc_calloc(size_t nmemb, size_t size);
  //! 
  //! Note: If size is 0, returns NULL without immediately freeing ptr.
  //!       The old allocation will be collected during next GC cycle.
+ //!       Blocks resized within their size class stay in place; other
+ //!       untyped blocks stay too while the new size fits their capacity
+ //!       and uses at least half of it. A block that has to move to grow gets
+ //!       half as much again in reserve for the next growth. Blocks past
+ //!       the large threshold are resized in their mapping instead, see
+ //!       gc_set_large_threshold.
  //! 
  //! Returns: Pointer to new allocation, or NULL on failure
  */
 void					*gc_realloc(void *ptr, size_t size);
 
+/**
+ //! gc_malloc_interior - Allocate memory kept alive by interior pointers
+ //! @size: Number of bytes to allocate
+ //! 
+ //! Note: Any address inside the block keeps it alive, not just the
+ //!       returned base pointer. Use it for buffers walked with cursors.
+ //! 
+ //! Returns: Pointer to new allocation, or NULL on failure
+ **/
+void					*gc_malloc_interior(size_t size);
+
+/**
+ //! gc_set_interior_pointers - Recognize interior pointers for all blocks
+ //! @enable: Non-zero to enable, 0 to recognize base pointers only
+ //! 
+ //! Note: Disabled by default. Enabling it retains more memory through
+ //!       false positives and makes marking slightly slower.
+ **/
+void					gc_set_interior_pointers(int enable);
+
+/**
+ //! gc_malloc_atomic - Allocate memory that never holds collected pointers
+ //! @size: Number of bytes to allocate
+ //! 
+ //! Note: The collector never scans the block, so pointers stored in it
+ //!       don't keep anything alive. Use it for strings, byte buffers
+ //!       and numeric arrays. The memory is not zeroed.
+ //! 
+ //! Returns: Pointer to new allocation, or NULL on failure
+ **/
+void					*gc_malloc_atomic(size_t size);
+void					*gc_calloc_atomic(size_t nmemb, size_t size);
+
+/**
+ //! gc_malloc_typed - Allocate zeroed memory with a known pointer layout
+ //! @size: Number of bytes to allocate
+ //! @layout: Pointer words of one element, copied into the block
+ //! 
+ //! Note: Only the words set in @layout are followed when marking.
+ //!       The layout repeats every @layout->words words, so an array of
+ //!       structs needs the layout of one struct.
+ //! 
+ //! Returns: Pointer to new allocation, or NULL on failure
+ **/
+void					*gc_malloc_typed(size_t size,
+							const t_gc_layout *layout);
+
+/**
+ //! gc_set_policy - Tune allocation-triggered collection
+ //! @policy: New policy, copied by the collector
+ //! 
+ //! Note: Defaults are a 4 MiB minimum budget, a growth factor of 1.0 and
+ //!       no maximum. Automatic collection needs collector_init first.
+ //!       Past @max_heap, allocations collect first and return NULL if
+ //!       the heap is still too large.
+ **/
+void					gc_set_policy(const t_gc_policy *policy);
+void					gc_get_policy(t_gc_policy *policy);
+
+/**
+ //! gc_disable - Suspend allocation-triggered collection
+ //! 
+ //! Note: Calls nest; each gc_disable needs a matching gc_enable.
+ //!       Explicit gc_collect calls still run.
+ **/
+void					gc_disable(void);
+void					gc_enable(void);
+
+/**
+ //! gc_set_lazy_sweep - Move page sweeping off the gc_collect pause
+ //! @enable: Non-zero to sweep lazily, 0 to sweep inside gc_collect
+ //! 
+ //! Note: In lazy mode gc_collect returns after marking. Pages are swept
+ //!       when an allocation reaches them, by gc_sweep_step, or at the
+ //!       start of the next collection, whichever comes first.
+ **/
+void					gc_set_lazy_sweep(int enable);
+
+/**
+ //! gc_sweep_step - Sweep pending pages during idle time
+ //! @budget: Maximum number of pages to sweep
+ //! 
+ //! Returns: 1 if unswept pages remain, 0 once the cycle is complete
+ **/
+int						gc_sweep_step(size_t budget);
+
+/**
+ //! gc_register_thread - Make the calling thread known to the collector
+ //! @stack_start: Address of a local in the thread's start routine, or
+ //!               NULL to use the whole stack reported by pthreads
+ //! 
+ //! Note: Registered threads are suspended while the collector marks and
+ //!       their stacks and registers are scanned. They allocate small
+ //!       objects from their own pages without taking the lock. A thread
+ //!       must unregister before it exits. collector_init registers the
+ //!       calling thread. SIGPWR and SIGXCPU are reserved.
+ //! 
+ //! Returns: 1 on success, 0 on failure
+ **/
+int						gc_register_thread(void *stack_start);
+void					gc_unregister_thread(void);
+
+/**
+ //! gc_set_mark_threads - Mark with several threads during collections
+ //! @count: Threads marking in parallel, the collecting thread included
+ //! 
+ //! Note: Defaults to 1, a serial mark. Helper threads are started by
+ //!       the next collection, steal grey objects from each other and
+ //!       sleep between collections. At most 64 are used.
+ **/
+void					gc_set_mark_threads(size_t count);
+
+/**
+ //! gc_set_generational - Collect young objects only, most of the time
+ //! @enable: Non-zero for sticky-mark generations, 0 for full collections
+ //! 
+ //! Note: Survivors stay marked as old. Minor collections trace from the
+ //!       roots, young objects and old objects on dirty cards only. A full
+ //!       collection runs once the old generation has grown by the
+ //!       policy's growth budget since the last one. In this mode
+ //!       min_heap alone sizes the young generation.
+ **/
+void					gc_set_generational(int enable);
+
+/**
+ //! gc_set_concurrent - Mark on a background thread while the program runs
+ //! @enable: Non-zero for mostly-concurrent collections, 0 to stop the world
+ //! 
+ //! Note: The world is stopped twice per collection: briefly to scan the
+ //!       roots, then to rescan the roots and the pages written while the
+ //!       background thread marked. Writes are found by write-protecting
+ //!       the heap: the first store to each page during a mark faults once
+ //!       into a SIGSEGV handler, which passes other faults on to the
+ //!       previous handler. System calls writing into collected memory
+ //!       fail with EFAULT during a mark; atomic blocks are never
+ //!       protected and suit such buffers. Collections triggered by
+ //!       allocation return once the mark started, gc_collect waits for
+ //!       the whole cycle.
+ **/
+void					gc_set_concurrent(int enable);
+
+/**
+ //! gc_collect_step - Advance a collection by one time-bounded slice
+ //! @budget_us: Time the step may take, in microseconds
+ //! 
+ //! Note: A step with no collection running starts one and scans the
+ //!       roots. Later steps mark until the budget runs out, then rescan
+ //!       the memory written meanwhile; once nothing is left they try to
+ //!       end the mark, rescanning the roots and the latest writes, and
+ //!       resume marking next time if that does not fit: a mark ends
+ //!       once a step catches up with the writes made since the last
+ //!       one. Large blocks are rescanned by kernel page, so a program
+ //!       rewriting most of its heap between steps should call
+ //!       gc_collect instead. Pages are then swept by the following
+ //!       steps. Writes between steps are tracked
+ //!       as in gc_set_concurrent, or by gc_write_barrier after
+ //!       gc_set_write_barrier. A step overruns its budget by about 4 KiB
+ //!       of scanning, one page to sweep or rescan and the root scan of
+ //!       an attempt to end the mark; typed objects are scanned whole.
+ //!       Without the write barrier, the first and last steps of a mark
+ //!       also protect and unprotect the heap, in time proportional to
+ //!       its size. Allocation that exhausts the policy budget meanwhile
+ //!       finishes the collection in one go.
+ //! 
+ //! Returns: 1 while the collection is in progress, 0 once it is swept
+ **/
+int						gc_collect_step(unsigned long budget_us);
+
+/**
+ //! gc_set_write_barrier - Track writes during a mark with gc_write_barrier
+ //! @enable: Non-zero if every pointer store goes through the barrier
+ //! 
+ //! Note: Concurrent and incremental marks then leave the heap writable
+ //!       and rescan the cards and blocks the barrier reported instead of
+ //!       the pages that faulted, so neither page faults nor EFAULT occur.
+ //!       A store the barrier misses during a mark may free a live object.
+ **/
+void					gc_set_write_barrier(int enable);
+
+/**
+ //! gc_write_barrier - Record a store into a collected object
+ //! @obj: Object written to, as returned by the allocator
+ //! @field: Address of the field that was written, inside @obj
+ //! 
+ //! Note: Needed in generational mode after storing a pointer to a
+ //!       collected object into @obj, unless @obj was allocated since the
+ //!       last collection. Without it a minor collection may free the
+ //!       target while @obj still points to it. With gc_set_write_barrier
+ //!       it is needed after every such store: it keeps a marked object
+ //!       from hiding an unmarked one between incremental steps.
+ **/
+void					gc_write_barrier(void *obj, void *field);
+
+/**
+ //! gc_add_root - Scan a memory range on every collection
+ //! @ptr: Pointer-aligned start of the range
+ //! @size: Length of the range in bytes
+ //! 
+ //! Note: Globals and statics of the program and of its shared libraries
+ //!       are already scanned. Use it for memory the collector can't
+ //!       see, such as buffers from malloc or mmap that hold pointers to
+ //!       collected objects.
+ //! 
+ //! Returns: 1 on success, 0 on failure
+ **/
+int						gc_add_root(void *ptr, size_t size);
+void					gc_remove_root(void *ptr);
+
+/**
+ //! gc_set_large_threshold - Give big blocks their own mapping
+ //! @bytes: Smallest size mapped directly from the kernel
+ //! 
+ //! Note: Defaults to 128 KiB. Such blocks are unmapped as soon as they
+ //!       are swept, and gc_realloc resizes them with mremap, which may
+ //!       move them: the old pointer must not be used afterwards.
+ //!       Values below the small-object limit only affect larger blocks.
+ **/
+void					gc_set_large_threshold(size_t bytes);
+
+/**
+ //! gc_trim - Return unused heap memory to the kernel
+ //! 
+ //! Note: Finishes any pending sweep, then releases the memory behind
+ //!       free slots of partly used pages and the free memory of malloc.
+ //!       The heap stays valid; released memory is refaulted on reuse.
+ //! 
+ //! Returns: Bytes of page memory released
+ **/
+size_t					gc_trim(void);
+
+/**
+ //! gc_set_compaction - Move objects out of sparse pages on full collections
+ //! @enable: Non-zero to compact, 0 to leave every object where it is
+ //! 
+ //! Note: Off by default. After each stop-the-world collection that is
+ //!       not minor, the world stops again and pages at most half full
+ //!       are emptied into the others and released, when that saves
+ //!       pages. Only small objects move, and only those referenced from
+ //!       nothing but the pointer words of typed objects, which are
+ //!       updated: a word of a stack, a register, a root, a region or an
+ //!       untyped object that may point into a page keeps the page in
+ //!       place. Concurrent and incremental collections don't compact.
+ //!       With it on, the address of such an object may change, so it
+ //!       must not be kept elsewhere, hidden in an integer or in memory
+ //!       the collector can't see.
+ **/
+void					gc_set_compaction(int enable);
+
+/**
+ //! gc_region_begin - Open an allocation region on the calling thread
+ //! 
+ //! Note: Until the matching gc_region_end, objects of up to 2048 bytes
+ //!       that are not typed are bump-allocated from 256 KiB chunks of
+ //!       the region instead of the heap; larger ones and those of
+ //!       another instance still come from the heap. Regions nest and
+ //!       belong to the instance current when they were opened. Their
+ //!       objects are never freed before the region ends, and anything
+ //!       they point to stays alive meanwhile. The thread must be
+ //!       registered, and must end its regions before gc_destroy or
+ //!       collector_close.
+ //! 
+ //! Returns: 1 on success, 0 on failure
+ **/
+int						gc_region_begin(void);
+
+/**
+ //! gc_region_end - Close the innermost region of the calling thread
+ //! 
+ //! Note: Stops the world and scans the stacks, the roots, the heap and
+ //!       the other open regions for references into the region, in
+ //!       time proportional to the heap. Chunks nothing points into are
+ //!       unmapped at once. A referenced chunk is moved to the heap as a
+ //!       whole, with everything it holds, and collected from then on:
+ //!       its objects can't be moved, since the references to them are
+ //!       found conservatively.
+ **/
+void					gc_region_end(void);
+
+/**
+ //! gc_free - Free an object without waiting for a collection
+ //! @ptr: Object returned by the allocator, NULL does nothing
+ //! 
+ //! Note: Nothing may use @ptr afterwards, weak references and
+ //!       finalizers included. Does nothing for region objects, for
+ //!       objects in the allocation buffer of another thread, for objects
+ //!       of a gc_create instance (see gc_free_ex), and while a concurrent
+ //!       or incremental mark runs.
+ **/
+void					gc_free(void *ptr);
+
+/**
+ //! gc_weak_ref_create - Refer to an object without keeping it alive
+ //! @ptr: Object of the default instance, not a region object
+ //! 
+ //! Note: The reference is itself a collected object: it lives as long
+ //!       as something points to it and must not be passed to gc_free.
+ //!       Once a collection finds @ptr unreachable other than through
+ //!       weak references, it clears them before its sweep. Minor
+ //!       collections only clear references to young objects. Objects
+ //!       of a gc_create instance are refused.
+ //! 
+ //! Returns: The weak reference, or NULL on failure or for an object the
+ //!          default instance doesn't own
+ **/
+gc_weak_t				*gc_weak_ref_create(void *ptr);
+
+/**
+ //! gc_weak_ref_get - Read a weak reference
+ //! @ref: Reference made by gc_weak_ref_create
+ //! 
+ //! Note: The pointer returned is an ordinary reference again, which keeps
+ //!       the object alive for as long as it is held.
+ //! 
+ //! Returns: The target, or NULL once it was collected
+ **/
+void					*gc_weak_ref_get(gc_weak_t *ref);
+
+/**
+ //! gc_register_finalizer - Run a function once an object is unreachable
+ //! @ptr: Object of the default instance, not a region object
+ //! @fn: Called with @ptr after a collection finds it unreachable
+ //! 
+ //! Note: Weak references to the object are cleared first. The object,
+ //!       and everything it points to, then survives that sweep and stays
+ //!       alive until @fn has run; it is collected by a later collection
+ //!       unless @fn stored it somewhere reachable. @fn runs once, in no
+ //!       particular order with the other finalizers, and never while the
+ //!       world is stopped or the lock is held: gc_collect runs the ready
+ //!       ones in batches before it returns, so does an allocation that
+ //!       had to take the lock, on registered threads only. A finalizer
+ //!       that allocates doesn't run the others. gc_collect_step leaves
+ //!       them to the next of those, and collector_close drops those
+ //!       that have not run. @ptr must not be passed to gc_free
+ //!       afterwards. Objects of a gc_create instance are refused.
+ //! 
+ //! Returns: 1 on success, 0 on failure or for an object the default
+ //!          instance doesn't own
+ **/
+int						gc_register_finalizer(void *ptr, t_gc_finalizer fn);
+
+/**
+ //! gc_run_finalizers - Run the finalizers that are ready, on this thread
+ //! 
+ //! Note: The calling thread must be registered. Does nothing when called
+ //!       from a finalizer.
+ //! 
+ //! Returns: Number of finalizers run
+ **/
+size_t					gc_run_finalizers(void);
+
+/**
+ //! gc_get_stats - Read the collector's counters
+ //! @stats: Filled with a snapshot of the counters
+ //! 
+ //! Note: Counters are always on and cost a few increments per
+ //!       allocation. They count from collector_init, collector_close
+ //!       clears them. Setting the GC_LOG environment variable to a value
+ //!       other than 0 before collector_init also prints one line per
+ //!       collection to stderr.
+ **/
+void					gc_get_stats(t_gc_stats *stats);
+
+/**
+ //! gc_set_event_callback - Be told when collection phases start and end
+ //! @fn: Called with the phase and @arg, or NULL to remove the callback
+ //! @arg: Passed to @fn unchanged
+ //! 
+ //! Note: @fn runs with the collector's lock held and must not allocate
+ //!       from the collector. With lazy sweeping, GC_EVENT_SWEEP_END only
+ //!       means the sweep was set up. GC_EVENT_PAUSE_BEGIN and
+ //!       GC_EVENT_PAUSE_END surround every stop-the-world pause. In
+ //!       concurrent mode a collection usually ends on the background
+ //!       thread, which then reports the later events.
+ **/
+void					gc_set_event_callback(t_gc_event_fn fn, void *arg);
+
+/**
+ //! gc_set_profiling - Sample allocations and record where they came from
+ //! @sample_bytes: Mean bytes allocated between two samples, 0 to stop
+ //! 
+ //! Note: Off by default; GC_PROFILE_RATE, 512 KiB, is cheap enough to
+ //!       leave on. Each thread counts down the bytes it allocates with
+ //!       gc_malloc, gc_calloc, gc_realloc and their atomic, interior and
+ //!       typed variants, over exponentially distributed intervals, and
+ //!       takes the backtrace of the allocation that crosses zero. So an
+ //!       object of n bytes is sampled with probability
+ //!       1 - exp(-n / @sample_bytes). Every collection then counts the
+ //!       sampled objects that survived it by call site and forgets the
+ //!       others. Region objects are not sampled. Applies to every
+ //!       instance; while off, an allocation costs one more branch.
+ **/
+void					gc_set_profiling(size_t sample_bytes);
+
+/**
+ //! gc_dump_heap - Collect and write every surviving object to a file
+ //! @fd: File descriptor the snapshot is written to
+ //! 
+ //! Note: Runs a collection of the default instance and, between its mark
+ //!       and its sweep, stops the world again to write the call sites,
+ //!       the marked objects and the references between them, found the
+ //!       way the mark found them. The memory map of the process follows,
+ //!       so that the return addresses can be symbolized. No registered
+ //!       thread may be the one reading @fd. The snapshot is a sequence
+ //!       of native 64-bit words: GC_DUMP_MAGIC and the sampling interval,
+ //!       then records, each starting with its tag:
+ //!       GC_DUMP_SITE: id, depth, samples, sampled bytes, surviving
+ //!                     samples, their bytes, then depth return addresses
+ //!       GC_DUMP_OBJECT: address, size, site id or 0, then kind bits:
+ //!                       1 interior, 2 atomic, 4 typed
+ //!       GC_DUMP_EDGE: address of the referencing object, of the target
+ //!       GC_DUMP_MAPS: length, then that many bytes of /proc/self/maps
+ //!                     padded to a word
+ //!       GC_DUMP_END: nothing, the last record
+ //!       Edges follow the object they start from. Objects that were not
+ //!       sampled have no site.
+ //! 
+ //! Returns: 1 on success, 0 if a write failed
+ **/
+int						gc_dump_heap(int fd);
+
+/**
+ //! gc_create - Make a collector instance independent of the default one
+ //! 
+ //! Note: The functions without the _ex suffix act on the default
+ //!       instance. Collecting an instance only scans and frees its own
+ //!       objects, marking from the roots, the data segments and the
+ //!       stacks of the registered threads, so objects only referenced
+ //!       from another instance's heap are not kept alive. Every
+ //!       instance shares the collector's lock and stops the same
+ //!       threads. Their allocations always take the lock: the
+ //!       per-thread buffers serve the default instance.
+ //!       Settings start at their defaults; the gc_set_* functions
+ //!       and gc_get_stats only apply to the default instance.
+ //! 
+ //! Returns: The new instance, or NULL on failure
+ **/
+gc_t					*gc_create(void);
+
+/**
+ //! gc_destroy - Free an instance and every object allocated from it
+ //! @gc: Instance made by gc_create, NULL does nothing
+ //! 
+ //! Note: Call it before collector_close.
+ **/
+void					gc_destroy(gc_t *gc);
+
+/**
+ //! gc_malloc_ex - gc_malloc from an instance
+ //! @gc: Instance made by gc_create, or NULL for the default instance
+ //! @size: Number of bytes to allocate
+ //! 
+ //! Returns: Pointer to new allocation, or NULL on failure
+ **/
+void					*gc_malloc_ex(gc_t *gc, size_t size);
+
+/**
+ //! gc_calloc_ex - gc_calloc from an instance
+ //! @gc: Instance made by gc_create, or NULL for the default instance
+ //! @nmemb: Number of elements
+ //! @size: Size of each element
+ //! 
+ //! Returns: Pointer to zeroed allocation, or NULL on failure
+ **/
+void					*gc_calloc_ex(gc_t *gc, size_t nmemb, size_t size);
+
+/**
+ //! gc_realloc_ex - gc_realloc within an instance
+ //! @gc: Instance @ptr was allocated from
+ //! @ptr: Pointer to reallocate
+ //! @size: New size
+ //! 
+ //! Returns: Pointer to new allocation, or NULL on failure
+ **/
+void					*gc_realloc_ex(gc_t *gc, void *ptr, size_t size);
+
+/**
+ //! gc_collect_ex - Collect one instance
+ //! @gc: Instance made by gc_create, or NULL for the default instance
+ **/
+void					gc_collect_ex(gc_t *gc);
+
+/**
+ //! gc_free_ex - gc_free within an instance
+ //! @gc: Instance @ptr was allocated from
+ //! @ptr: Object to free, NULL does nothing
+ **/
+void					gc_free_ex(gc_t *gc, void *ptr);
+
 #endif
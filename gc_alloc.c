@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_alloc.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:55:33 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:36:24 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Slots past page->fresh come straight from the kernel, still zeroed */
+static void	note_fresh(t_gc_page *page, size_t slot)
+{
+	*get_gc_fresh() = (slot >= page->fresh);
+	if (slot >= page->fresh)
+		page->fresh = slot + 1;
+}
+
+//!/* Words before page->cursor are known to be full until the next sweep */
+void	*gc_page_take_slot(t_gc_page *page)
+{
+	size_t			word;
+	size_t			slot;
+	unsigned long	free_bits;
+
+	if (page->live_count == page->obj_count)
+		return (NULL);
+	word = page->cursor;
+	while (word < page->words)
+	{
+		free_bits = ~page->alloc_bits[word];
+		if (free_bits)
+		{
+			slot = word * GC_WORD_BITS + __builtin_ctzl(free_bits);
+			if (slot >= page->obj_count)
+				return (NULL);
+			page->alloc_bits[word] |= 1UL << (slot % GC_WORD_BITS);
+			page->live_count++;
+			page->cursor = word;
+			note_fresh(page, slot);
+			return (page->base + slot * page->obj_size);
+		}
+		word++;
+	}
+	return (NULL);
+}
+
+//!/* Called with the lock held; pages owned by a thread are skipped */
+t_gc_page	*gc_page_acquire(size_t size_class, unsigned char flags)
+{
+	t_gc_heap	*heap;
+	t_gc_page	*page;
+
+	heap = get_gc_heap();
+	page = heap->current[flags][size_class];
+	while (page)
+	{
+		if (!page->owner)
+		{
+			if (page->sweep_epoch != heap->epoch)
+				gc_page_sweep(page);
+			if (page->live_count < page->obj_count)
+				return (page);
+		}
+		page = page->next;
+		heap->current[flags][size_class] = page;
+	}
+	return (gc_page_create(size_class, flags));
+}
+
+//!/* Large blocks always take the lock; small ones go through the TLAB */
+//!/* An open region takes what fits in its chunks */
+void	*gc_alloc(size_t size, unsigned char flags)
+{
+	void	*ptr;
+
+	if (size == 0)
+		return (NULL);
+	if (*get_gc_region_self())
+	{
+		ptr = gc_region_alloc(size, flags);
+		if (ptr)
+			return (ptr);
+	}
+	if (size <= GC_SMALL_MAX)
+		return (gc_alloc_small(size, flags));
+	ptr = NULL;
+	gc_lock();
+	if (gc_policy_admit(size))
+		ptr = gc_alloc_large(size, flags);
+	if (ptr)
+		get_gc_heap()->allocated_bytes += sizeof(t_collecter) + size;
+	if (ptr)
+		get_gc_stats_state()->allocs[gc_stats_bucket(size)]++;
+	gc_unlock();
+	gc_finalize_pending();
+	return (ptr);
+}
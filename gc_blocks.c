@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_blocks.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:59:20 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:59:20 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+size_t	gc_blocks_home(t_gc_blocks *set, t_collecter *node)
+{
+	uintptr_t	hash;
+
+	hash = ((uintptr_t)node >> 4) * 0x9e3779b97f4a7c15UL;
+	return ((hash >> 32) & (set->capacity - 1));
+}
+
+static void	insert(t_gc_blocks *set, t_collecter *node)
+{
+	size_t	i;
+
+	i = gc_blocks_home(set, node);
+	while (set->slots[i])
+		i = (i + 1) & (set->capacity - 1);
+	set->slots[i] = node;
+}
+
+static int	grow(t_gc_blocks *set)
+{
+	t_gc_blocks	old;
+	size_t		i;
+
+	old = *set;
+	set->capacity = 64;
+	if (old.capacity)
+		set->capacity = old.capacity * 2;
+	set->slots = calloc(set->capacity, sizeof(t_collecter *));
+	if (!set->slots)
+	{
+		*set = old;
+		return (0);
+	}
+	i = 0;
+	while (i < old.capacity)
+	{
+		if (old.slots[i])
+			insert(set, old.slots[i]);
+		i++;
+	}
+	free(old.slots);
+	return (1);
+}
+
+//!/* A block left out when the table can't grow is still found by */
+//!/* gc_owner, through the block index */
+void	gc_blocks_add(t_collecter *node)
+{
+	t_gc_blocks	*set;
+
+	set = &get_gc_heap()->blocks;
+	if ((set->count + 1) * 2 > set->capacity && !grow(set))
+		return ;
+	insert(set, node);
+	set->count++;
+}
+
+//!/* Compares addresses only: ptr need not point to anything */
+t_collecter	*gc_blocks_find(void *ptr)
+{
+	t_gc_blocks	*set;
+	t_collecter	*node;
+	size_t		i;
+
+	set = &get_gc_heap()->blocks;
+	if (!set->capacity)
+		return (NULL);
+	node = (t_collecter *)((uintptr_t)ptr - sizeof(t_collecter));
+	i = gc_blocks_home(set, node);
+	while (set->slots[i])
+	{
+		if (set->slots[i] == node)
+			return (node);
+		i = (i + 1) & (set->capacity - 1);
+	}
+	return (NULL);
+}
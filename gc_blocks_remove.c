@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_blocks_remove.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:59:20 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:59:20 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Linear probing without tombstones: each later entry of the run moves */
+//!/* into the hole unless that would put it before its home slot */
+static void	shift_back(t_gc_blocks *set, size_t hole)
+{
+	size_t	mask;
+	size_t	next;
+	size_t	home;
+
+	mask = set->capacity - 1;
+	next = (hole + 1) & mask;
+	while (set->slots[next])
+	{
+		home = gc_blocks_home(set, set->slots[next]);
+		if (((next - home) & mask) >= ((next - hole) & mask))
+		{
+			set->slots[hole] = set->slots[next];
+			hole = next;
+		}
+		next = (next + 1) & mask;
+	}
+	set->slots[hole] = NULL;
+}
+
+//!/* Reads no header, so node may already be unmapped */
+void	gc_blocks_remove(t_collecter *node)
+{
+	t_gc_blocks	*set;
+	size_t		i;
+
+	set = &get_gc_heap()->blocks;
+	if (!set->capacity)
+		return ;
+	i = gc_blocks_home(set, node);
+	while (set->slots[i] && set->slots[i] != node)
+		i = (i + 1) & (set->capacity - 1);
+	if (!set->slots[i])
+		return ;
+	shift_back(set, i);
+	set->count--;
+}
+
+void	gc_blocks_release(void)
+{
+	t_gc_blocks	*set;
+
+	set = &get_gc_heap()->blocks;
+	free(set->slots);
+	set->slots = NULL;
+	set->count = 0;
+	set->capacity = 0;
+}
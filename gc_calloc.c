@@ -6,26 +6,13 @@
 /*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 16:57:16 by akivam            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 23:31:25 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "internal_collector.h"
 
-static void	gc_bzero(void *s, size_t n)
-{
-	size_t			i;
-	unsigned char	*tmp;
-
-	i = 0;
-	tmp = s;
-	while (i < n)
-	{
-		tmp[i] = (unsigned char)0;
-		i = i + 1;
-	}
-}
-
+//!/* Memory fresh from the kernel is already zeroed */
 void	*gc_calloc(size_t nmemb, size_t size)
 {
 	size_t	total_size;
@@ -39,6 +26,7 @@ void	*gc_calloc(size_t nmemb, size_t size)
 	ptr = gc_malloc(total_size);
 	if (!ptr)
 		return (NULL);
-	gc_bzero(ptr, total_size);
+	if (!*get_gc_fresh())
+		gc_memset(ptr, 0, total_size);
 	return (ptr);
 }
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_cards.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:16:48 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:04:14 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Rescans the marked objects overlapping one dirty card */
+void	gc_scan_card(t_gc_page *page, size_t card)
+{
+	size_t	slot;
+	size_t	end;
+
+	slot = (card << GC_CARD_SHIFT) / page->obj_size;
+	end = (((card + 1) << GC_CARD_SHIFT) - 1) / page->obj_size;
+	while (slot <= end && slot < page->obj_count)
+	{
+		if (page->mark_bits[slot / GC_WORD_BITS]
+			& (1UL << (slot % GC_WORD_BITS)))
+			gc_scan_object(page->base + slot * page->obj_size,
+				page->obj_size, page->flags);
+		slot++;
+	}
+}
+
+//!/* The final pause of a concurrent mark rescans cards in any collection */
+//!/* An incremental attempt to end it may fail, so it keeps them set */
+static void	scan_dirty_page(t_gc_page *page)
+{
+	size_t	card;
+	int		rescan;
+	int		keep;
+
+	if (!page->dirty)
+		return ;
+	rescan = (get_gc_heap()->minor || get_gc_concurrent()->active);
+	keep = gc_concurrent_sticky();
+	page->dirty = keep;
+	card = 0;
+	while (card < GC_CARD_COUNT)
+	{
+		if (page->cards[card] && rescan)
+			gc_scan_card(page, card);
+		if (!keep)
+			page->cards[card] = 0;
+		card++;
+	}
+}
+
+//!/* Only mapped blocks are write-protected during a concurrent mark: */
+//!/* the final pause rescans every other marked block. Faulted pages stay */
+//!/* writable, so their cards stay set until an incremental mark ends */
+static void	scan_dirty_blocks(void)
+{
+	t_collecter	*node;
+	int			minor;
+	int			final;
+
+	minor = get_gc_heap()->minor;
+	final = get_gc_concurrent()->active;
+	node = *get_gc_head();
+	while (node)
+	{
+		if (node->is_marked && final)
+			gc_concurrent_rescan_block(node);
+		else if (node->dirty && node->is_marked && minor)
+			gc_scan_object((void *)(node + 1), node->size, node->flags);
+		if (!(node->dirty && final && gc_concurrent_sticky()))
+			gc_large_cards_fill(node, 0);
+		node = node->next;
+	}
+}
+
+//!/* Runs with the world stopped; full collections only clear the cards */
+void	gc_scan_dirty_cards(void)
+{
+	gc_heap_for_each_page(scan_dirty_page);
+	scan_dirty_blocks();
+}
+
+//!/* Large blocks have a card per kernel page once mapped; region objects */
+//!/* dirty the chunk they sit in. Anything else the current instance */
+//!/* doesn't own has no card to set */
+void	gc_write_barrier(void *obj, void *field)
+{
+	t_gc_page	*page;
+	int			owner;
+
+	page = gc_page_find(field);
+	if (page)
+	{
+		page->cards[((char *)field - page->base) >> GC_CARD_SHIFT] = 1;
+		page->dirty = 1;
+	}
+	if (page || !obj)
+		return ;
+	gc_lock();
+	owner = gc_owner(obj);
+	if (owner == GC_OWNER_REGION)
+		gc_large_dirty(gc_region_chunk(obj), field);
+	else if (owner == GC_OWNER_LARGE)
+		gc_large_dirty((t_collecter *)obj - 1, field);
+	gc_unlock();
+}
@@ -6,14 +6,48 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 20:06:01 by akivam            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 01:36:24 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "internal_collector.h"
 
-void	gc_collect(void)
+//!/* Pending lazy sweeps finish first: they still need the old mark bits */
+//!/* Only tracing runs with the other registered threads suspended */
+void	gc_mark(void)
 {
+	gc_mark_prepare();
+	gc_stop_world();
+	mark_from_stack();
+	gc_roots_scan();
+	gc_scan_dirty_cards();
+	gc_mark_publish(gc_mark_parallel());
+	gc_start_world();
+}
+
+//!/* Called with the lock held; phase times exclude the event callbacks */
+//!/* Full collections end with a compaction when it is enabled */
+void	gc_collect_stw(void)
+{
+	unsigned long long	start;
+	unsigned long long	mark_ns;
+
+	gc_stats_event(GC_EVENT_MARK_BEGIN);
+	start = gc_now_ns();
 	gc_mark();
-	gc_sweep();
+	mark_ns = gc_now_ns() - start;
+	gc_stats_event(GC_EVENT_MARK_END);
+	gc_collect_sweep(mark_ns, get_gc_config()->lazy_sweep);
+	if (get_gc_config()->compact && !get_gc_heap()->minor)
+		gc_compact();
+}
+
+//!/* A concurrent or incremental mark in progress is finished first; */
+//!/* the finalizers it readied run once the lock is released */
+void	gc_collect(void)
+{
+	gc_lock();
+	gc_concurrent_collect(1);
+	gc_unlock();
+	gc_finalize_pending();
 }
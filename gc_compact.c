@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_compact.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:15:14 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:40:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	clear_flags(t_gc_page *page)
+{
+	page->pinned = 0;
+	page->moving = 0;
+}
+
+static size_t	each_class(size_t (*fn)(size_t, size_t))
+{
+	size_t	kind;
+	size_t	size_class;
+	size_t	total;
+
+	total = 0;
+	kind = 0;
+	while (kind < GC_KIND_COUNT)
+	{
+		size_class = 0;
+		while (size_class < GC_CLASS_COUNT)
+		{
+			total += fn(kind, size_class);
+			size_class++;
+		}
+		kind++;
+	}
+	return (total);
+}
+
+//!/* Called with the lock held once a full collection has swept. Pages */
+//!/* nothing ambiguous points into and that are at most half full are */
+//!/* evacuated into the others, then the typed pointers are updated. */
+//!/* A stopped thread may hold a malloc lock: pages are made before the */
+//!/* world stops and freed once it restarts */
+void	gc_compact(void)
+{
+	t_gc_stats	*stats;
+	size_t		moved;
+
+	gc_sweep_finish();
+	gc_heap_for_each_page(clear_flags);
+	each_class(gc_compact_reserve);
+	gc_heap_for_each_page(clear_flags);
+	gc_stop_world();
+	gc_compact_pin_all();
+	moved = each_class(gc_compact_class);
+	if (moved)
+		gc_compact_fix();
+	if (moved)
+		gc_profile_forward();
+	if (moved)
+		gc_finalize_forward();
+	stats = get_gc_stats_state();
+	stats->moved_objects += moved;
+	stats->evacuated_pages += each_class(gc_compact_unlink);
+	gc_heap_rewind();
+	gc_start_world();
+	gc_compact_release();
+}
+
+void	gc_set_compaction(int enable)
+{
+	gc_lock();
+	get_gc_config()->compact = (enable != 0);
+	gc_unlock();
+}
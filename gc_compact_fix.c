@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_compact_fix.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:15:14 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:17:17 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Where a pointer into an evacuated page leads now, offset included */
+void	*gc_compact_forward(void *ptr)
+{
+	t_gc_page	*page;
+	size_t		slot;
+	char		*start;
+
+	page = gc_page_find(ptr);
+	if (!page || !page->moving)
+		return (ptr);
+	slot = (size_t)((char *)ptr - page->base) / page->obj_size;
+	if (slot >= page->obj_count
+		|| !(page->alloc_bits[slot / GC_WORD_BITS]
+			& (1UL << (slot % GC_WORD_BITS))))
+		return (ptr);
+	start = page->base + slot * page->obj_size;
+	return (*(char **)start + ((char *)ptr - start));
+}
+
+//!/* Same walk as scan_typed: only the layout's pointer words change. An */
+//!/* object still being set up by gc_malloc_typed may have no layout yet */
+static void	fix_typed(void *start, size_t size)
+{
+	t_gc_layout	*layout;
+	void		**words;
+	size_t		count;
+	size_t		i;
+
+	layout = (t_gc_layout *)((char *)start + size) - 1;
+	if (layout->words == 0 || layout->words > GC_WORD_BITS)
+		return ;
+	words = start;
+	count = (size - sizeof(t_gc_layout)) / sizeof(void *);
+	i = 0;
+	while (i < count)
+	{
+		if (layout->bitmap & (1UL << (i % layout->words)))
+			words[i] = gc_compact_forward(words[i]);
+		i++;
+	}
+}
+
+//!/* Objects left on evacuated pages are stale copies */
+static void	fix_page(t_gc_page *page)
+{
+	size_t	slot;
+
+	if (!(page->flags & GC_FLAG_TYPED) || page->moving)
+		return ;
+	slot = 0;
+	while (slot < page->obj_count)
+	{
+		if (page->alloc_bits[slot / GC_WORD_BITS]
+			& (1UL << (slot % GC_WORD_BITS)))
+			fix_typed(page->base + slot * page->obj_size, page->obj_size);
+		slot++;
+	}
+}
+
+//!/* Runs with the world stopped, before the evacuated pages go */
+void	gc_compact_fix(void)
+{
+	t_collecter	*node;
+
+	gc_heap_for_each_page(fix_page);
+	node = *get_gc_head();
+	while (node)
+	{
+		if (node->flags & GC_FLAG_TYPED)
+			fix_typed(node + 1, node->size);
+		node = node->next;
+	}
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_compact_move.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:15:14 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:40:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* First page from this one on that can take moved objects */
+t_gc_page	*gc_compact_target(t_gc_page *page)
+{
+	while (page && (page->moving || page->owner
+			|| page->live_count == page->obj_count))
+		page = page->next;
+	return (page);
+}
+
+//!/* The old slot keeps the new address in its first word. Marks move */
+//!/* with the objects, for the generational mode */
+static t_gc_page	*move_object(t_gc_page *page, size_t slot, t_gc_page *to)
+{
+	char	*src;
+	char	*dst;
+	size_t	index;
+
+	src = page->base + slot * page->obj_size;
+	dst = gc_page_take_slot(to);
+	while (!dst)
+	{
+		to = gc_compact_target(to->next);
+		dst = gc_page_take_slot(to);
+	}
+	gc_memcpy(dst, src, page->obj_size);
+	index = (size_t)(dst - to->base) / to->obj_size;
+	if (page->mark_bits[slot / GC_WORD_BITS]
+		& (1UL << (slot % GC_WORD_BITS)))
+		to->mark_bits[index / GC_WORD_BITS] |= 1UL << (index % GC_WORD_BITS);
+	*(void **)src = dst;
+	return (to);
+}
+
+//!/* Runs with the world stopped; gc_compact_select made room for every */
+//!/* object it flagged. Returns the objects moved */
+size_t	gc_compact_class(size_t kind, size_t size_class)
+{
+	t_gc_page	*page;
+	t_gc_page	*to;
+	size_t		slot;
+	size_t		moved;
+
+	if (!gc_compact_select(kind, size_class))
+		return (0);
+	page = get_gc_heap()->pages[kind][size_class];
+	to = gc_compact_target(page);
+	moved = 0;
+	while (page)
+	{
+		slot = 0;
+		while (page->moving && slot < page->obj_count)
+		{
+			if (page->alloc_bits[slot / GC_WORD_BITS]
+				& (1UL << (slot % GC_WORD_BITS)))
+				to = move_object(page, slot, to);
+			slot++;
+		}
+		if (page->moving)
+			moved += page->live_count;
+		page = page->next;
+	}
+	return (moved);
+}
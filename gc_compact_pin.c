@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_compact_pin.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:15:14 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:15:14 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Any word that may be a pointer into a page keeps the whole page */
+void	gc_compact_pin(void *start, size_t size)
+{
+	void		**word;
+	void		**end;
+	t_gc_page	*page;
+
+	word = start;
+	end = (void **)((char *)start + size);
+	while (word < end)
+	{
+		page = gc_page_find(*word);
+		if (page)
+			page->pinned = 1;
+		word++;
+	}
+}
+
+//!/* Pointers in typed objects are precise and get updated instead */
+static void	pin_page(t_gc_page *page)
+{
+	size_t	slot;
+
+	if (page->flags & (GC_FLAG_ATOMIC | GC_FLAG_TYPED))
+		return ;
+	slot = 0;
+	while (slot < page->obj_count)
+	{
+		if (page->alloc_bits[slot / GC_WORD_BITS]
+			& (1UL << (slot % GC_WORD_BITS)))
+			gc_compact_pin(page->base + slot * page->obj_size,
+				page->obj_size);
+		slot++;
+	}
+}
+
+static void	pin_ranges(t_gc_range_list *list)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < list->count)
+	{
+		gc_compact_pin(list->items[i].start, list->items[i].size);
+		i++;
+	}
+}
+
+static void	pin_regions(void)
+{
+	t_gc_region	*region;
+	t_collecter	*chunk;
+
+	region = get_gc_heap()->regions;
+	while (region)
+	{
+		chunk = region->chunks;
+		while (chunk)
+		{
+			gc_compact_pin(chunk + 1, chunk->size);
+			chunk = chunk->next;
+		}
+		region = region->next;
+	}
+}
+
+//!/* Runs with the world stopped on a swept heap: the stacks, registers, */
+//!/* roots, open regions and untyped objects are all ambiguous */
+void	gc_compact_pin_all(void)
+{
+	t_collecter	*node;
+
+	gc_stacks_for_each(gc_compact_pin);
+	pin_ranges(&get_gc_roots()->segments);
+	pin_ranges(&get_gc_roots()->user);
+	pin_regions();
+	gc_heap_for_each_page(pin_page);
+	node = *get_gc_head();
+	while (node)
+	{
+		if (!(node->flags & (GC_FLAG_ATOMIC | GC_FLAG_TYPED)))
+			gc_compact_pin(node + 1, node->size);
+		node = node->next;
+	}
+}
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_compact_release.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:40:52 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:40:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	push_evacuated(t_gc_heap *heap, t_gc_page *page)
+{
+	page->next = heap->evacuated;
+	heap->evacuated = page;
+}
+
+//!/* Runs with the world stopped: evacuated pages leave their class list */
+//!/* for heap->evacuated. Returns the pages unlinked */
+size_t	gc_compact_unlink(size_t kind, size_t size_class)
+{
+	t_gc_heap	*heap;
+	t_gc_page	**link;
+	t_gc_page	*page;
+	t_gc_page	*prev;
+	size_t		unlinked;
+
+	heap = get_gc_heap();
+	link = &heap->pages[kind][size_class];
+	prev = NULL;
+	unlinked = 0;
+	while (*link)
+	{
+		page = *link;
+		if (page->moving)
+		{
+			*link = page->next;
+			push_evacuated(heap, page);
+			unlinked++;
+			continue ;
+		}
+		prev = page;
+		link = &page->next;
+	}
+	heap->last[kind][size_class] = prev;
+	return (unlinked);
+}
+
+//!/* Called with the lock held once the world runs again: freeing while */
+//!/* it is stopped could wait on a malloc lock a stopped thread holds */
+void	gc_compact_release(void)
+{
+	t_gc_heap	*heap;
+	t_gc_page	*page;
+
+	heap = get_gc_heap();
+	while (heap->evacuated)
+	{
+		page = heap->evacuated;
+		heap->evacuated = page->next;
+		gc_page_destroy(page);
+	}
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_compact_select.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:15:14 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:40:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Unpinned pages at most half full, outside any thread's buffer */
+static int	movable(t_gc_page *page)
+{
+	return (!page->pinned && !page->owner && page->live_count > 0
+		&& page->live_count * 2 <= page->obj_count);
+}
+
+//!/* Flags the pages of a class that may be evacuated; returns how many, */
+//!/* with the objects they hold in live */
+static size_t	flag_class(size_t kind, size_t size_class, size_t *live)
+{
+	t_gc_page	*page;
+	size_t		count;
+
+	count = 0;
+	*live = 0;
+	page = get_gc_heap()->pages[kind][size_class];
+	while (page)
+	{
+		page->moving = movable(page);
+		count += page->moving;
+		*live += page->live_count * page->moving;
+		page = page->next;
+	}
+	return (count);
+}
+
+//!/* Makes room for need objects up front, so that no evacuation stops */
+//!/* halfway, unless that takes limit new pages or more: with a limit of */
+//!/* 0 it only checks the room already there */
+static int	reserve(size_t kind, size_t size_class, size_t need,
+		size_t limit)
+{
+	t_gc_page	*page;
+	size_t		room;
+	size_t		per_page;
+
+	room = 0;
+	page = gc_compact_target(get_gc_heap()->pages[kind][size_class]);
+	while (page && room < need)
+	{
+		room += page->obj_count - page->live_count;
+		page = gc_compact_target(page->next);
+	}
+	per_page = GC_PAGE_SIZE / gc_class_size(size_class);
+	if (room < need && (need - room + per_page - 1) / per_page >= limit)
+		return (0);
+	while (room < need)
+	{
+		if (!gc_page_create(size_class, kind))
+			return (0);
+		room += per_page;
+	}
+	return (1);
+}
+
+//!/* Runs before the world stops, with nothing pinned yet: creating pages */
+//!/* calls malloc. Pinning only takes pages out of the evacuation and */
+//!/* makes them targets, so this room covers what gc_compact_select keeps */
+size_t	gc_compact_reserve(size_t kind, size_t size_class)
+{
+	size_t	count;
+	size_t	live;
+
+	count = flag_class(kind, size_class, &live);
+	if (count > 0)
+		reserve(kind, size_class, live, count);
+	return (0);
+}
+
+//!/* Runs with the world stopped and flags the pages of a class to */
+//!/* evacuate, when their objects fit in the room gc_compact_reserve left. */
+//!/* New pages left empty by a failure go at the next sweep */
+int	gc_compact_select(size_t kind, size_t size_class)
+{
+	t_gc_page	*page;
+	size_t		count;
+	size_t		live;
+	int			keep;
+
+	count = flag_class(kind, size_class, &live);
+	keep = (count > 0 && reserve(kind, size_class, live, 0));
+	page = get_gc_heap()->pages[kind][size_class];
+	while (page && !keep)
+	{
+		page->moving = 0;
+		page = page->next;
+	}
+	return (keep);
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_concurrent.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:50:57 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:46:23 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Called with the lock held. The roots are scanned with the world */
+//!/* stopped, then writes are tracked while the background thread or the */
+//!/* incremental steps mark from them. Returns 0 if that can't be set up */
+int	gc_concurrent_begin(int background)
+{
+	t_gc_concurrent	*concurrent;
+
+	concurrent = get_gc_concurrent();
+	concurrent->protecting = !get_gc_config()->barrier;
+	if ((concurrent->protecting && !gc_protect_install())
+		|| (background && !gc_concurrent_thread_start()))
+		return (0);
+	gc_stats_event(GC_EVENT_MARK_BEGIN);
+	concurrent->start_ns = gc_now_ns();
+	gc_mark_prepare();
+	concurrent->allocated = get_gc_heap()->allocated_bytes;
+	concurrent->marked_bytes = 0;
+	gc_stop_world();
+	mark_from_stack();
+	gc_roots_scan();
+	gc_scan_dirty_cards();
+	gc_protect_heap(1);
+	concurrent->active = 1;
+	concurrent->incremental = !background;
+	concurrent->cycle++;
+	gc_start_world();
+	if (background)
+		gc_concurrent_drain_begin();
+	return (1);
+}
+
+//!/* Called with the lock held. Once the background drain is done, the */
+//!/* roots and the pages written since the first pause are rescanned with */
+//!/* the world stopped; what they reach is marked before the sweep */
+void	gc_concurrent_finish(void)
+{
+	if (!get_gc_concurrent()->active)
+		return ;
+	gc_concurrent_drain_wait();
+	gc_filter_update();
+	gc_roots_refresh();
+	gc_stop_world();
+	mark_from_stack();
+	gc_roots_scan();
+	gc_scan_dirty_cards();
+	gc_concurrent_complete(get_gc_concurrent()->marked_bytes
+		+ gc_mark_parallel());
+}
+
+//!/* Runs with the world stopped once nothing is left to mark. Incremental */
+//!/* cycles sweep lazily so that gc_collect_step can spread the sweep too */
+void	gc_concurrent_complete(size_t marked)
+{
+	t_gc_concurrent		*concurrent;
+	unsigned long long	mark_ns;
+
+	concurrent = get_gc_concurrent();
+	gc_protect_heap(0);
+	concurrent->active = 0;
+	gc_mark_publish(marked);
+	gc_start_world();
+	mark_ns = gc_now_ns() - concurrent->start_ns;
+	gc_stats_event(GC_EVENT_MARK_END);
+	gc_collect_sweep(mark_ns,
+		get_gc_config()->lazy_sweep || concurrent->incremental);
+}
+
+//!/* Called with the lock held. A running cycle is finished first, so */
+//!/* allocation that outruns the mark waits for it; wait also runs a whole */
+//!/* new cycle, as gc_collect does, in the background when concurrent */
+void	gc_concurrent_collect(int wait)
+{
+	if (get_gc_concurrent()->active)
+	{
+		gc_concurrent_finish();
+		if (!wait)
+			return ;
+	}
+	if (!get_gc_config()->concurrent || !gc_concurrent_begin(1))
+		gc_collect_stw();
+	else if (wait)
+		gc_concurrent_finish();
+}
+
+//!/* Protected blocks can only have changed in their first kernel page, */
+//!/* which stays writable for the header, and in the pages that faulted. */
+//!/* Without protection the write barrier set their cards */
+void	gc_concurrent_rescan_block(t_collecter *node)
+{
+	size_t	prefix;
+	int		protecting;
+	int		whole;
+
+	prefix = gc_protect_prefix(node);
+	protecting = get_gc_concurrent()->protecting;
+	whole = (protecting && (prefix == 0 || prefix >= node->size));
+	if (!whole && node->dirty)
+		whole = !gc_large_cards_push(node, 0);
+	if (whole)
+		gc_scan_object((void *)(node + 1), node->size, node->flags);
+	else if (protecting)
+		gc_scan_object((void *)(node + 1), prefix, node->flags);
+}
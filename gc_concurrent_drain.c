@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_concurrent_drain.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:50:57 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:46:23 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* The roots of the first pause are already on the mark stack */
+void	gc_concurrent_drain_begin(void)
+{
+	t_gc_concurrent	*concurrent;
+
+	concurrent = get_gc_concurrent();
+	pthread_mutex_lock(&concurrent->mutex);
+	concurrent->marked_bytes = 0;
+	__atomic_store_n(&concurrent->draining, 1, __ATOMIC_RELEASE);
+	pthread_cond_broadcast(&concurrent->wake);
+	pthread_mutex_unlock(&concurrent->mutex);
+}
+
+//!/* The drain never takes the lock, so lock holders may wait for it */
+void	gc_concurrent_drain_wait(void)
+{
+	t_gc_concurrent	*concurrent;
+
+	concurrent = get_gc_concurrent();
+	pthread_mutex_lock(&concurrent->mutex);
+	while (concurrent->draining)
+		pthread_cond_wait(&concurrent->wake, &concurrent->mutex);
+	pthread_mutex_unlock(&concurrent->mutex);
+}
+
+//!/* Called with the lock held: a cycle waits for its final pause */
+int	gc_concurrent_drained(void)
+{
+	t_gc_concurrent	*concurrent;
+
+	concurrent = get_gc_concurrent();
+	return (concurrent->active && !concurrent->incremental
+		&& !__atomic_load_n(&concurrent->draining, __ATOMIC_ACQUIRE));
+}
+
+void	gc_set_concurrent(int enable)
+{
+	gc_lock();
+	if (!enable)
+		gc_concurrent_finish();
+	get_gc_config()->concurrent = (enable != 0);
+	gc_unlock();
+}
+
+//!/* Set while rescanned memory must stay dirty: a failed attempt to end */
+//!/* an incremental mark leaves it writable */
+int	gc_concurrent_sticky(void)
+{
+	t_gc_concurrent	*concurrent;
+
+	concurrent = get_gc_concurrent();
+	return (concurrent->active && concurrent->incremental
+		&& concurrent->protecting);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_concurrent_thread.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:50:57 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	init_sync(t_gc_concurrent *concurrent)
+{
+	pthread_mutex_init(&concurrent->mutex, NULL);
+	pthread_cond_init(&concurrent->wake, NULL);
+	concurrent->sync = 1;
+}
+
+//!/* Called and returns with the mutex held. The lock is only tried: its */
+//!/* holder may be waiting for this thread to drain a newer cycle. If it */
+//!/* is busy, the next allocation slow path runs the final pause instead */
+static void	run_drain(t_gc_concurrent *concurrent)
+{
+	size_t	marked;
+	size_t	cycle;
+
+	cycle = concurrent->cycle;
+	pthread_mutex_unlock(&concurrent->mutex);
+	marked = gc_mark_parallel();
+	pthread_mutex_lock(&concurrent->mutex);
+	concurrent->marked_bytes = marked;
+	__atomic_store_n(&concurrent->draining, 0, __ATOMIC_RELEASE);
+	pthread_cond_broadcast(&concurrent->wake);
+	pthread_mutex_unlock(&concurrent->mutex);
+	if (gc_trylock())
+	{
+		if (concurrent->cycle == cycle)
+			gc_concurrent_finish();
+		gc_unlock();
+	}
+	pthread_mutex_lock(&concurrent->mutex);
+}
+
+//!/* Not registered: it holds no roots and keeps running while the world */
+//!/* is stopped, but only marks between the two pauses. arg is the */
+//!/* instance it marks for */
+static void	*concurrent_main(void *arg)
+{
+	t_gc_concurrent	*concurrent;
+
+	gc_instance_switch(arg);
+	concurrent = get_gc_concurrent();
+	pthread_mutex_lock(&concurrent->mutex);
+	while (!concurrent->shutdown)
+	{
+		if (concurrent->draining)
+			run_drain(concurrent);
+		else
+			pthread_cond_wait(&concurrent->wake, &concurrent->mutex);
+	}
+	pthread_mutex_unlock(&concurrent->mutex);
+	return (NULL);
+}
+
+//!/* Called with the lock held, before the world stops */
+int	gc_concurrent_thread_start(void)
+{
+	t_gc_concurrent	*concurrent;
+
+	concurrent = get_gc_concurrent();
+	if (!concurrent->sync)
+		init_sync(concurrent);
+	if (concurrent->started)
+		return (1);
+	if (pthread_create(&concurrent->thread, NULL, concurrent_main,
+			*get_gc_current()) != 0)
+		return (0);
+	concurrent->started = 1;
+	return (1);
+}
+
+//!/* Called without the lock: the thread may need it to end its cycle */
+void	gc_concurrent_thread_stop(void)
+{
+	t_gc_concurrent	*concurrent;
+
+	concurrent = get_gc_concurrent();
+	gc_lock();
+	gc_concurrent_finish();
+	gc_unlock();
+	if (concurrent->started)
+	{
+		pthread_mutex_lock(&concurrent->mutex);
+		concurrent->shutdown = 1;
+		pthread_cond_broadcast(&concurrent->wake);
+		pthread_mutex_unlock(&concurrent->mutex);
+		pthread_join(concurrent->thread, NULL);
+		concurrent->started = 0;
+		concurrent->shutdown = 0;
+	}
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_dump.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:27:30 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:27:30 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+//!/* Short writes are resumed; the first failure ends the dump */
+void	gc_dump_flush(t_gc_dump *dump)
+{
+	size_t	done;
+	ssize_t	written;
+
+	done = 0;
+	while (dump->ok && done < dump->used)
+	{
+		written = write(dump->fd, dump->buffer + done, dump->used - done);
+		if (written < 0 && errno == EINTR)
+			continue ;
+		if (written <= 0)
+			dump->ok = 0;
+		else
+			done += (size_t)written;
+	}
+	dump->used = 0;
+}
+
+void	gc_dump_bytes(t_gc_dump *dump, const void *data, size_t size)
+{
+	size_t	chunk;
+
+	while (size > 0)
+	{
+		if (dump->used == GC_DUMP_BUFFER)
+			gc_dump_flush(dump);
+		chunk = GC_DUMP_BUFFER - dump->used;
+		if (chunk > size)
+			chunk = size;
+		gc_memcpy(dump->buffer + dump->used, data, chunk);
+		dump->used += chunk;
+		data = (const char *)data + chunk;
+		size -= chunk;
+	}
+}
+
+void	gc_dump_word(t_gc_dump *dump, uint64_t word)
+{
+	gc_dump_bytes(dump, &word, sizeof(word));
+}
+
+//!/* One record per read, each padded to a word */
+static void	dump_maps(t_gc_dump *dump)
+{
+	char		chunk[1024];
+	uint64_t	zero;
+	ssize_t		got;
+	int			fd;
+
+	fd = open("/proc/self/maps", O_RDONLY);
+	if (fd < 0)
+		return ;
+	zero = 0;
+	got = read(fd, chunk, sizeof(chunk));
+	while (got > 0)
+	{
+		gc_dump_word(dump, GC_DUMP_MAPS);
+		gc_dump_word(dump, (uint64_t)got);
+		gc_dump_bytes(dump, chunk, (size_t)got);
+		gc_dump_bytes(dump, &zero, (sizeof(zero) - got % sizeof(zero))
+			% sizeof(zero));
+		got = read(fd, chunk, sizeof(chunk));
+	}
+	close(fd);
+}
+
+//!/* The collection writes the objects and clears profile->dump; the */
+//!/* memory map is read once the world runs again */
+int	gc_dump_heap(int fd)
+{
+	t_gc_dump		dump;
+	t_gc_profile	*profile;
+	int				written;
+
+	dump.fd = fd;
+	dump.ok = 1;
+	dump.used = 0;
+	gc_lock();
+	profile = get_gc_profile();
+	profile->dump = &dump;
+	gc_concurrent_collect(1);
+	written = (profile->dump == NULL);
+	profile->dump = NULL;
+	gc_unlock();
+	if (!written)
+		return (0);
+	dump_maps(&dump);
+	gc_dump_word(&dump, GC_DUMP_END);
+	gc_dump_flush(&dump);
+	return (dump.ok);
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_dump_objects.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:27:30 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:27:30 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Same filter and lookups as the mark; only what it marked counts */
+static void	*dump_target(void *ptr)
+{
+	t_gc_filter	*filter;
+	t_gc_page	*page;
+	t_collecter	*node;
+	size_t		slot;
+	uintptr_t	word;
+
+	filter = &get_gc_heap()->filter;
+	word = (uintptr_t)ptr;
+	if ((((word - filter->min) >> filter->shift) | (word & filter->align)))
+		return (NULL);
+	page = gc_page_find(ptr);
+	if (page)
+	{
+		if (!gc_page_slot(page, ptr, &slot)
+			|| !(page->mark_bits[slot / GC_WORD_BITS]
+				& (1UL << (slot % GC_WORD_BITS))))
+			return (NULL);
+		return (page->base + slot * page->obj_size);
+	}
+	node = gc_index_find(ptr);
+	if (!node || !node->is_marked)
+		return (NULL);
+	return (node + 1);
+}
+
+//!/* The words the mark would have followed, as in gc_scan_object */
+static void	dump_edges(t_gc_dump *dump, void **words, size_t size,
+	unsigned char flags)
+{
+	t_gc_layout	*layout;
+	size_t		count;
+	size_t		i;
+	void		*target;
+
+	layout = NULL;
+	count = size / sizeof(void *);
+	if (flags & GC_FLAG_TYPED)
+		layout = (t_gc_layout *)((char *)words + size) - 1;
+	if (layout)
+		count -= sizeof(t_gc_layout) / sizeof(void *);
+	i = 0;
+	while (!(flags & GC_FLAG_ATOMIC) && i < count
+		&& (!layout || (layout->words && layout->words <= GC_WORD_BITS)))
+	{
+		target = dump_target(words[i]);
+		if (target && (!layout
+				|| (layout->bitmap & (1UL << (i % layout->words)))))
+		{
+			gc_dump_word(dump, GC_DUMP_EDGE);
+			gc_dump_word(dump, (uintptr_t)words);
+			gc_dump_word(dump, (uintptr_t)target);
+		}
+		i++;
+	}
+}
+
+static void	dump_object(void *ptr, size_t size, unsigned char flags)
+{
+	t_gc_dump	*dump;
+	t_gc_sample	**link;
+	size_t		site;
+
+	dump = get_gc_profile()->dump;
+	link = gc_profile_find(ptr);
+	site = 0;
+	if (link && *link)
+		site = (*link)->site->id;
+	gc_dump_word(dump, GC_DUMP_OBJECT);
+	gc_dump_word(dump, (uintptr_t)ptr);
+	gc_dump_word(dump, size);
+	gc_dump_word(dump, site);
+	gc_dump_word(dump, flags);
+	dump_edges(dump, ptr, size, flags);
+}
+
+static void	dump_page(t_gc_page *page)
+{
+	size_t			word;
+	size_t			slot;
+	unsigned long	bits;
+
+	word = 0;
+	while (word < page->words)
+	{
+		bits = page->mark_bits[word] & page->alloc_bits[word];
+		while (bits)
+		{
+			slot = word * GC_WORD_BITS + __builtin_ctzl(bits);
+			dump_object(page->base + slot * page->obj_size,
+				page->obj_size, page->flags);
+			bits &= bits - 1;
+		}
+		word++;
+	}
+}
+
+//!/* Called by gc_profile_collect with the lock held once the mark ended: */
+//!/* the world stops again so that the objects hold still while written */
+void	gc_dump_objects(void)
+{
+	t_gc_dump	*dump;
+	t_collecter	*node;
+
+	dump = get_gc_profile()->dump;
+	gc_stop_world();
+	gc_dump_word(dump, GC_DUMP_MAGIC);
+	gc_dump_word(dump, *get_gc_profile_period());
+	gc_dump_sites(dump);
+	gc_heap_for_each_page(dump_page);
+	node = *get_gc_head();
+	while (node)
+	{
+		if (node->is_marked)
+			dump_object(node + 1, node->size, node->flags);
+		node = node->next;
+	}
+	gc_start_world();
+	get_gc_profile()->dump = NULL;
+}
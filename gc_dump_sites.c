@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_dump_sites.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:27:30 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:27:30 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	dump_site(t_gc_dump *dump, t_gc_site *site)
+{
+	gc_dump_word(dump, GC_DUMP_SITE);
+	gc_dump_word(dump, site->id);
+	gc_dump_word(dump, site->depth);
+	gc_dump_word(dump, site->samples);
+	gc_dump_word(dump, site->sampled_bytes);
+	gc_dump_word(dump, site->live_samples);
+	gc_dump_word(dump, site->live_bytes);
+	gc_dump_bytes(dump, site->frames, site->depth * sizeof(void *));
+}
+
+//!/* Sites come first so that object records can name them */
+void	gc_dump_sites(t_gc_dump *dump)
+{
+	t_gc_profile	*profile;
+	t_gc_site		*site;
+	size_t			i;
+
+	profile = get_gc_profile();
+	i = 0;
+	while (profile->samples && i < GC_PROFILE_BUCKETS)
+	{
+		site = profile->sites[i];
+		while (site)
+		{
+			dump_site(dump, site);
+			site = site->next;
+		}
+		i++;
+	}
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_finalize.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:36:24 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:37:06 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Only objects with a mark of their own, on the current instance */
+int	gc_register_finalizer(void *ptr, t_gc_finalizer fn)
+{
+	int	owner;
+	int	added;
+
+	if (!ptr || !fn)
+		return (0);
+	gc_lock();
+	owner = gc_owner(ptr);
+	added = 0;
+	if (owner == GC_OWNER_PAGE || owner == GC_OWNER_LARGE)
+		added = gc_final_list_add(&get_gc_finalize()->registered, ptr, fn);
+	gc_unlock();
+	return (added);
+}
+
+//!/* Moves up to GC_FINALIZE_BATCH ready finalizers to batch. Held there, */
+//!/* on the stack of a registered thread, their objects stay alive */
+static size_t	take_batch(t_gc_final *batch)
+{
+	t_gc_final_list	*ready;
+	size_t			count;
+
+	gc_lock();
+	ready = &get_gc_finalize()->ready;
+	count = 0;
+	while (count < GC_FINALIZE_BATCH && ready->count > 0)
+	{
+		ready->count--;
+		batch[count] = ready->items[ready->count];
+		count++;
+	}
+	gc_unlock();
+	return (count);
+}
+
+size_t	gc_run_finalizers(void)
+{
+	t_gc_final	batch[GC_FINALIZE_BATCH];
+	size_t		total;
+	size_t		count;
+	size_t		i;
+
+	if (*get_gc_finalizing() || !*get_gc_thread_self())
+		return (0);
+	*get_gc_finalizing() = 1;
+	total = 0;
+	count = take_batch(batch);
+	while (count > 0)
+	{
+		i = 0;
+		while (i < count)
+		{
+			batch[i].fn(batch[i].ptr);
+			i++;
+		}
+		total += count;
+		count = take_batch(batch);
+	}
+	*get_gc_finalizing() = 0;
+	return (total);
+}
+
+//!/* Called once the lock is released by gc_collect and the allocation */
+//!/* slow paths; only a load while nothing is ready. A finalizer that */
+//!/* allocates must not change what the caller's block reports as fresh */
+void	gc_finalize_pending(void)
+{
+	int	fresh;
+
+	if (!__atomic_load_n(&get_gc_finalize()->ready.count, __ATOMIC_RELAXED))
+		return ;
+	fresh = *get_gc_fresh();
+	gc_run_finalizers();
+	*get_gc_fresh() = fresh;
+}
+
+//!/* Called with the lock held by gc_instance_release; finalizers that */
+//!/* have not run are dropped */
+void	gc_finalize_release(void)
+{
+	t_gc_finalize	*finalize;
+
+	finalize = get_gc_finalize();
+	free(finalize->weak.items);
+	free(finalize->registered.items);
+	free(finalize->ready.items);
+	gc_memset(finalize, 0, sizeof(t_gc_finalize));
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_finalize_collect.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:36:24 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:36:24 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+int	gc_final_list_add(t_gc_final_list *list, void *ptr, t_gc_finalizer fn)
+{
+	t_gc_final	*items;
+	size_t		capacity;
+
+	if (list->count == list->capacity)
+	{
+		capacity = list->capacity * 2;
+		if (capacity == 0)
+			capacity = 16;
+		items = realloc(list->items, capacity * sizeof(t_gc_final));
+		if (!items)
+			return (0);
+		list->items = items;
+		list->capacity = capacity;
+	}
+	list->items[list->count].ptr = ptr;
+	list->items[list->count].fn = fn;
+	list->count++;
+	return (1);
+}
+
+//!/* Runs with the world stopped, from gc_roots_scan */
+void	gc_finalize_scan_roots(void)
+{
+	t_gc_final_list	*ready;
+	size_t			i;
+
+	ready = &get_gc_finalize()->ready;
+	i = 0;
+	while (i < ready->count)
+	{
+		mark_pointer(ready->items[i].ptr);
+		i++;
+	}
+}
+
+//!/* Registered objects the mark missed move to the ready list, whose */
+//!/* growth failing leaves them registered; either way they are marked */
+static void	queue_unmarked(t_gc_finalize *finalize)
+{
+	t_gc_final	entry;
+	size_t		kept;
+	size_t		i;
+
+	kept = 0;
+	i = 0;
+	while (i < finalize->registered.count)
+	{
+		entry = finalize->registered.items[i];
+		i++;
+		if (gc_is_marked(entry.ptr))
+			finalize->registered.items[kept++] = entry;
+		else if (!gc_final_list_add(&finalize->ready, entry.ptr, entry.fn))
+			finalize->registered.items[kept++] = entry;
+		mark_pointer(entry.ptr);
+	}
+	finalize->registered.count = kept;
+}
+
+//!/* Called with the lock held between a mark and its sweep. Weak refs */
+//!/* are cleared before finalizable objects are marked again, with */
+//!/* everything they reach, so that the sweep keeps them for their */
+//!/* finalizer. No mutator can reach them, so this runs with the world */
+//!/* going */
+void	gc_finalize_collect(void)
+{
+	t_gc_finalize	*finalize;
+
+	finalize = get_gc_finalize();
+	gc_weak_clear();
+	if (finalize->registered.count == 0)
+		return ;
+	queue_unmarked(finalize);
+	gc_mark_drain();
+}
+
+//!/* Called by gc_compact once the objects moved, weak references first */
+void	gc_finalize_forward(void)
+{
+	t_gc_finalize	*finalize;
+	size_t			i;
+
+	gc_weak_forward();
+	finalize = get_gc_finalize();
+	i = 0;
+	while (i < finalize->registered.count)
+	{
+		finalize->registered.items[i].ptr
+			= gc_compact_forward(finalize->registered.items[i].ptr);
+		i++;
+	}
+	i = 0;
+	while (i < finalize->ready.count)
+	{
+		finalize->ready.items[i].ptr
+			= gc_compact_forward(finalize->ready.items[i].ptr);
+		i++;
+	}
+}
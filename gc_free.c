@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_free.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:04:29 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:57:00 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Pages in a thread's TLAB are written without the lock by their owner, */
+//!/* so only its own thread frees into them. A page the lazy sweep hasn't */
+//!/* reached yet is swept first, so that it doesn't count the slot twice */
+static size_t	free_small(t_gc_page *page, void *ptr)
+{
+	size_t			slot;
+	size_t			word;
+	unsigned long	bit;
+
+	if (page->owner && page->owner != get_gc_shared_thread()
+		&& page->owner != *get_gc_thread_self())
+		return (0);
+	if (page->sweep_epoch != get_gc_heap()->epoch)
+		gc_page_sweep(page);
+	if (!gc_page_slot(page, ptr, &slot)
+		|| page->base + slot * page->obj_size != (char *)ptr)
+		return (0);
+	word = slot / GC_WORD_BITS;
+	bit = 1UL << (slot % GC_WORD_BITS);
+	page->alloc_bits[word] &= ~bit;
+	page->mark_bits[word] &= ~bit;
+	page->live_count--;
+	if (word < page->cursor)
+		page->cursor = word;
+	return (page->obj_size);
+}
+
+//!/* The list is doubly linked, so the block leaves it in O(1). A lazy */
+//!/* sweep standing on its link goes back to the link before it */
+static size_t	free_large(t_collecter *node)
+{
+	t_gc_heap	*heap;
+	size_t		size;
+
+	heap = get_gc_heap();
+	if (heap->large_cursor == &node->next && node->prev)
+		heap->large_cursor = &node->prev->next;
+	else if (heap->large_cursor == &node->next)
+		heap->large_cursor = get_gc_head();
+	if (node->prev)
+		node->prev->next = node->next;
+	else
+		*get_gc_head() = node->next;
+	if (node->next)
+		node->next->prev = node->prev;
+	size = sizeof(t_collecter) + node->size;
+	gc_large_free(node);
+	get_gc_index()->valid = 0;
+	return (size);
+}
+
+//!/* What was freed no longer counts towards the next collection, nor */
+//!/* towards the profile */
+static void	count_freed(void *ptr, size_t freed)
+{
+	t_gc_heap	*heap;
+
+	heap = get_gc_heap();
+	if (freed > heap->allocated_bytes)
+		heap->allocated_bytes = 0;
+	else
+		heap->allocated_bytes -= freed;
+	get_gc_stats_state()->freed_objects++;
+	get_gc_stats_state()->freed_bytes += freed;
+	gc_profile_forget(ptr);
+}
+
+//!/* Region objects go with their chunk; nothing is freed while a */
+//!/* concurrent mark may be tracing the object, nor what the current */
+//!/* instance doesn't own */
+void	gc_free(void *ptr)
+{
+	t_gc_page	*page;
+	size_t		freed;
+
+	if (!ptr)
+		return ;
+	gc_lock();
+	freed = 0;
+	page = gc_page_find(ptr);
+	if (get_gc_concurrent()->active)
+		freed = 0;
+	else if (page)
+		freed = free_small(page, ptr);
+	else if (gc_owner(ptr) == GC_OWNER_LARGE)
+		freed = free_large(get_header_from_ptr(ptr));
+	if (freed)
+		count_freed(ptr, freed);
+	gc_unlock();
+}
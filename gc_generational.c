@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_generational.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:16:48 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:16:48 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	clear_page_marks(t_gc_page *page)
+{
+	size_t	word;
+
+	word = 0;
+	while (word < page->words)
+	{
+		page->mark_bits[word] = 0;
+		word++;
+	}
+}
+
+//!/* Same budget rule as allocation: growth_factor of the last full */
+//!/* collection's survivors, but never below min_heap */
+static int	major_due(t_gc_heap *heap)
+{
+	t_gc_policy	*policy;
+	size_t		budget;
+
+	policy = &get_gc_config()->policy;
+	budget = (size_t)(heap->major_live * policy->growth_factor);
+	if (budget < policy->min_heap)
+		budget = policy->min_heap;
+	return (heap->live_bytes >= heap->major_live + budget);
+}
+
+//!/* Called after the pending sweep finished; large marks are cleared */
+//!/* by gc_index_build */
+void	gc_generation_begin(void)
+{
+	t_gc_heap	*heap;
+	int			generational;
+
+	heap = get_gc_heap();
+	generational = get_gc_config()->generational;
+	heap->minor = (generational && heap->sticky && !major_due(heap));
+	if (!heap->minor && heap->sticky)
+		gc_heap_for_each_page(clear_page_marks);
+	heap->sticky = generational;
+}
+
+void	gc_generation_end(void)
+{
+	t_gc_heap	*heap;
+
+	heap = get_gc_heap();
+	if (!heap->minor)
+		heap->major_live = heap->live_bytes;
+}
+
+void	gc_set_generational(int enable)
+{
+	gc_lock();
+	get_gc_config()->generational = (enable != 0);
+	gc_unlock();
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_heap.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:55:33 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:04:14 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+void	gc_heap_for_each_page(void (*fn)(t_gc_page *))
+{
+	t_gc_heap	*heap;
+	t_gc_page	*page;
+	t_gc_page	*next;
+	size_t		kind;
+	size_t		size_class;
+
+	heap = get_gc_heap();
+	kind = 0;
+	while (kind < GC_KIND_COUNT)
+	{
+		size_class = 0;
+		while (size_class < GC_CLASS_COUNT)
+		{
+			page = heap->pages[kind][size_class];
+			while (page)
+			{
+				next = page->next;
+				fn(page);
+				page = next;
+			}
+			size_class++;
+		}
+		kind++;
+	}
+}
+
+//!/* Allocation restarts from the first page of every class */
+void	gc_heap_rewind(void)
+{
+	t_gc_heap	*heap;
+	size_t		kind;
+	size_t		size_class;
+
+	heap = get_gc_heap();
+	kind = 0;
+	while (kind < GC_KIND_COUNT)
+	{
+		size_class = 0;
+		while (size_class < GC_CLASS_COUNT)
+		{
+			heap->current[kind][size_class] = heap->pages[kind][size_class];
+			size_class++;
+		}
+		kind++;
+	}
+}
+
+static void	clear_class_lists(t_gc_heap *heap)
+{
+	size_t	kind;
+	size_t	size_class;
+
+	kind = 0;
+	while (kind < GC_KIND_COUNT)
+	{
+		size_class = 0;
+		while (size_class < GC_CLASS_COUNT)
+		{
+			heap->pages[kind][size_class] = NULL;
+			heap->last[kind][size_class] = NULL;
+			heap->current[kind][size_class] = NULL;
+			size_class++;
+		}
+		kind++;
+	}
+}
+
+void	gc_heap_release(void)
+{
+	gc_heap_for_each_page(gc_page_destroy);
+	clear_class_lists(get_gc_heap());
+	gc_page_map_release();
+	gc_blocks_release();
+}
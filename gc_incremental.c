@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_incremental.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:06:06 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:46:23 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Tries to end the mark within the step: with the world stopped, the */
+//!/* roots and the memory written since the last preclean are rescanned */
+//!/* and what they reach marked. Out of time, marking resumes next step */
+static void	try_finish(unsigned long long deadline)
+{
+	gc_filter_update();
+	gc_roots_refresh();
+	gc_stop_world();
+	mark_from_stack();
+	gc_roots_scan();
+	gc_preclean((unsigned long long)-1);
+	gc_scan_dirty_cards();
+	if (gc_mark_drain_until(deadline))
+	{
+		gc_concurrent_complete(gc_mark_parallel());
+		return ;
+	}
+	gc_start_world();
+}
+
+static int	sweep_pending(t_gc_heap *heap)
+{
+	return (heap->unswept > 0 || heap->large_cursor != NULL);
+}
+
+//!/* The sweep of the last cycle ends before the next one starts. A */
+//!/* background cycle is left to its thread unless its drain is over. The */
+//!/* filter follows the heap, since precleaning consumes the dirty cards */
+static void	advance(t_gc_concurrent *concurrent, unsigned long long deadline)
+{
+	if (gc_concurrent_drained())
+		gc_concurrent_finish();
+	if (!concurrent->active && sweep_pending(get_gc_heap()))
+	{
+		while (gc_sweep_step(1) && gc_now_ns() < deadline)
+			;
+		return ;
+	}
+	if (!concurrent->active && !gc_concurrent_begin(0))
+	{
+		gc_collect_stw();
+		return ;
+	}
+	if (!concurrent->incremental)
+		return ;
+	gc_filter_update();
+	if (gc_mark_drain_until(deadline) && gc_preclean(deadline)
+		&& gc_mark_drain_until(deadline) && gc_now_ns() < deadline)
+		try_finish(deadline);
+}
+
+int	gc_collect_step(unsigned long budget_us)
+{
+	t_gc_concurrent		*concurrent;
+	unsigned long long	deadline;
+	int					pending;
+
+	gc_lock();
+	deadline = gc_now_ns() + (unsigned long long)budget_us * 1000;
+	concurrent = get_gc_concurrent();
+	advance(concurrent, deadline);
+	pending = (concurrent->active || sweep_pending(get_gc_heap()));
+	gc_unlock();
+	return (pending);
+}
+
+//!/* A cycle in progress keeps the tracking it started with */
+void	gc_set_write_barrier(int enable)
+{
+	gc_lock();
+	get_gc_config()->barrier = (enable != 0);
+	gc_unlock();
+}
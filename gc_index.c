@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_index.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:50:49 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:16:53 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static int	compare_blocks(const void *a, const void *b)
+{
+	uintptr_t	left;
+	uintptr_t	right;
+
+	left = (uintptr_t)*(t_collecter *const *)a;
+	right = (uintptr_t)*(t_collecter *const *)b;
+	if (left < right)
+		return (-1);
+	return (left > right);
+}
+
+static int	reserve_index(t_gc_index *index, size_t count)
+{
+	t_collecter	**blocks;
+	size_t		capacity;
+
+	if (count <= index->capacity)
+		return (1);
+	capacity = index->capacity;
+	if (capacity == 0)
+		capacity = 64;
+	while (capacity < count)
+		capacity *= 2;
+	blocks = malloc(capacity * sizeof(t_collecter *));
+	if (!blocks)
+		return (0);
+	free(index->blocks);
+	index->blocks = blocks;
+	index->capacity = capacity;
+	return (1);
+}
+
+static size_t	count_blocks(void)
+{
+	t_collecter	*node;
+	size_t		count;
+
+	count = 0;
+	node = *get_gc_head();
+	while (node)
+	{
+		count++;
+		node = node->next;
+	}
+	return (count);
+}
+
+static void	fill_blocks(t_gc_index *index)
+{
+	t_collecter	*node;
+	int			minor;
+
+	index->count = 0;
+	index->interior_count = 0;
+	minor = get_gc_heap()->minor;
+	node = *get_gc_head();
+	while (node)
+	{
+		if (!minor)
+			node->is_marked = 0;
+		index->blocks[index->count] = node;
+		index->count++;
+		if (node->flags & GC_FLAG_INTERIOR)
+			index->interior_count++;
+		node = node->next;
+	}
+}
+
+//!/* Leaves valid == 0 (linear lookups) if the table can't grow */
+//!/* Also whitens blocks allocated marked during the last lazy sweep; */
+//!/* minor collections keep the marks of old blocks */
+void	gc_index_build(void)
+{
+	t_gc_index	*index;
+	t_collecter	*last;
+
+	index = get_gc_index();
+	index->valid = 0;
+	if (!reserve_index(index, count_blocks()))
+		return ;
+	fill_blocks(index);
+	index->min = 0;
+	index->max = 0;
+	if (index->count > 0)
+	{
+		qsort(index->blocks, index->count, sizeof(t_collecter *),
+			compare_blocks);
+		last = index->blocks[index->count - 1];
+		index->min = (uintptr_t)(index->blocks[0] + 1);
+		index->max = (uintptr_t)(last + 1) + last->size;
+	}
+	index->valid = 1;
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_index_find.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:50:49 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 22:52:07 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Any address in [data, data + size) counts in interior mode */
+static int	block_contains(t_collecter *node, uintptr_t addr)
+{
+	uintptr_t	data;
+
+	data = (uintptr_t)(node + 1);
+	if (addr == data)
+		return (1);
+	if (addr < data || addr >= data + node->size)
+		return (0);
+	return (get_gc_config()->interior_pointers
+		|| (node->flags & GC_FLAG_INTERIOR));
+}
+
+static t_collecter	*find_linear(void *ptr)
+{
+	t_collecter	*node;
+
+	node = *get_gc_head();
+	while (node)
+	{
+		if (block_contains(node, (uintptr_t)ptr))
+			return (node);
+		node = node->next;
+	}
+	return (NULL);
+}
+
+//!/* Unaligned words can only hit a block when interior pointers count */
+static int	in_heap_bounds(t_gc_index *index, uintptr_t addr)
+{
+	if (addr < index->min || addr >= index->max)
+		return (0);
+	if (get_gc_config()->interior_pointers || index->interior_count > 0)
+		return (1);
+	return (addr % sizeof(void *) == 0);
+}
+
+//!/* Binary search for the last block starting at or below the address */
+t_collecter	*gc_index_find(void *ptr)
+{
+	t_gc_index	*index;
+	uintptr_t	addr;
+	size_t		low;
+	size_t		high;
+	size_t		mid;
+
+	index = get_gc_index();
+	if (!index->valid)
+		return (find_linear(ptr));
+	addr = (uintptr_t)ptr;
+	if (!in_heap_bounds(index, addr))
+		return (NULL);
+	low = 0;
+	high = index->count;
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+		if ((uintptr_t)(index->blocks[mid] + 1) <= addr)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	if (low > 0 && block_contains(index->blocks[low - 1], addr))
+		return (index->blocks[low - 1]);
+	return (NULL);
+}
+
+void	gc_index_release(void)
+{
+	t_gc_index	*index;
+
+	index = get_gc_index();
+	free(index->blocks);
+	index->blocks = NULL;
+	index->count = 0;
+	index->interior_count = 0;
+	index->capacity = 0;
+	index->valid = 0;
+}
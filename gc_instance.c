@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_instance.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:49:55 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:21:13 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Same settings as a fresh default instance; GC_LOG applies to all */
+static void	set_defaults(t_gc_instance *instance, int log)
+{
+	instance->config.policy.min_heap = GC_DEFAULT_MIN_HEAP;
+	instance->config.policy.growth_factor = 1.0;
+	instance->config.mark_threads = 1;
+	instance->config.large_threshold = GC_DEFAULT_LARGE_THRESHOLD;
+	instance->config.log = log;
+}
+
+gc_t	*gc_create(void)
+{
+	t_gc_instance	*instance;
+	t_gc_instance	**instances;
+
+	instance = calloc(1, sizeof(t_gc_instance));
+	if (!instance)
+		return (NULL);
+	gc_lock();
+	set_defaults(instance, get_gc_config()->log);
+	instances = get_gc_instances();
+	instance->next = *instances;
+	__atomic_store_n(instances, instance, __ATOMIC_RELEASE);
+	gc_unlock();
+	return (instance);
+}
+
+//!/* Called with the lock held; frees every object of the current instance */
+void	gc_instance_release(void)
+{
+	t_collecter	**head_ptr;
+	t_collecter	*current;
+	t_collecter	*next;
+
+	gc_thread_release_tlab(get_gc_shared_thread());
+	head_ptr = get_gc_head();
+	current = *head_ptr;
+	while (current)
+	{
+		next = current->next;
+		gc_large_free(current);
+		current = next;
+	}
+	*head_ptr = NULL;
+	gc_region_release();
+	gc_profile_release();
+	gc_finalize_release();
+	gc_heap_release();
+	gc_index_release();
+	gc_markers_stop();
+	gc_roots_release();
+	gc_mark_stack_release();
+	gc_stats_release();
+}
+
+//!/* With the world stopped no thread is inside the fault handler, which */
+//!/* walks the list without the lock */
+static void	unlink_instance(t_gc_instance *instance)
+{
+	t_gc_instance	**link;
+
+	gc_stop_world();
+	link = get_gc_instances();
+	while (*link && *link != instance)
+		link = &(*link)->next;
+	if (*link)
+		*link = instance->next;
+	gc_start_world();
+}
+
+//!/* The background thread may need the lock to end its cycle */
+void	gc_destroy(gc_t *gc)
+{
+	t_gc_instance	*previous;
+
+	if (!gc)
+		return ;
+	previous = gc_instance_switch(gc);
+	gc_concurrent_thread_stop();
+	gc_lock();
+	unlink_instance(gc);
+	gc_instance_release();
+	gc_unlock();
+	gc_instance_switch(previous);
+	free(gc);
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_instance_alloc.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:49:55 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:57:00 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+void	*gc_malloc_ex(gc_t *gc, size_t size)
+{
+	t_gc_instance	*previous;
+	void			*ptr;
+
+	previous = gc_instance_switch(gc);
+	ptr = gc_malloc(size);
+	gc_instance_switch(previous);
+	return (ptr);
+}
+
+void	*gc_calloc_ex(gc_t *gc, size_t nmemb, size_t size)
+{
+	t_gc_instance	*previous;
+	void			*ptr;
+
+	previous = gc_instance_switch(gc);
+	ptr = gc_calloc(nmemb, size);
+	gc_instance_switch(previous);
+	return (ptr);
+}
+
+void	*gc_realloc_ex(gc_t *gc, void *ptr, size_t size)
+{
+	t_gc_instance	*previous;
+
+	previous = gc_instance_switch(gc);
+	ptr = gc_realloc(ptr, size);
+	gc_instance_switch(previous);
+	return (ptr);
+}
+
+void	gc_collect_ex(gc_t *gc)
+{
+	t_gc_instance	*previous;
+
+	previous = gc_instance_switch(gc);
+	gc_collect();
+	gc_instance_switch(previous);
+}
+
+void	gc_free_ex(gc_t *gc, void *ptr)
+{
+	t_gc_instance	*previous;
+
+	previous = gc_instance_switch(gc);
+	gc_free(ptr);
+	gc_instance_switch(previous);
+}
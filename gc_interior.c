@@ -0,0 +1,27 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_interior.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:52:07 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:44:17 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+void	*gc_malloc_interior(size_t size)
+{
+	return (gc_profile_note(gc_alloc(size, GC_FLAG_INTERIOR), size));
+}
+
+//!/* Under the lock like the other setters: a mark that holds it sees */
+//!/* one rule from start to end */
+void	gc_set_interior_pointers(int enable)
+{
+	gc_lock();
+	get_gc_config()->interior_pointers = (enable != 0);
+	gc_unlock();
+}
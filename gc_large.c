@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_large.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:26:50 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:09:01 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+//!/* Header and data rounded up to whole kernel pages */
+size_t	gc_large_length(size_t size)
+{
+	size_t	page;
+
+	page = (size_t)sysconf(_SC_PAGESIZE);
+	return ((sizeof(t_collecter) + size + page - 1) & ~(page - 1));
+}
+
+//!/* Anonymous mappings come zeroed; the header sits at the start and the */
+//!/* card table is malloc'd beside it */
+t_collecter	*gc_large_map(size_t size)
+{
+	t_collecter	*header;
+	size_t		length;
+
+	length = gc_large_length(size);
+	header = mmap(NULL, length, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (header == MAP_FAILED)
+		return (NULL);
+	header->mapped = length;
+	header->cards = calloc(length / (size_t)sysconf(_SC_PAGESIZE), 1);
+	return (header);
+}
+
+//!/* Memory the block holds, as counted in heap->large_bytes; the same */
+//!/* for as long as it lives, whatever its size */
+size_t	gc_large_footprint(t_collecter *header)
+{
+	return (sizeof(t_collecter) + gc_large_capacity(header));
+}
+
+//!/* Mapped blocks go straight back to the kernel, the rest to malloc */
+void	gc_large_free(t_collecter *header)
+{
+	gc_blocks_remove(header);
+	get_gc_heap()->large_bytes -= gc_large_footprint(header);
+	if (header->mapped)
+	{
+		free(header->cards);
+		munmap(header, header->mapped);
+	}
+	else
+		free(header);
+}
+
+void	gc_set_large_threshold(size_t bytes)
+{
+	gc_lock();
+	get_gc_config()->large_threshold = bytes;
+	gc_unlock();
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_large_cards.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:38:50 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:46:23 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+//!/* Mapped blocks have a card per kernel page, saying which parts of */
+//!/* them need a rescan. addr NULL dirties the whole block. Safe in the */
+//!/* fault handler: nothing is allocated */
+void	gc_large_dirty(t_collecter *node, void *addr)
+{
+	size_t	page;
+	size_t	card;
+
+	page = (size_t)sysconf(_SC_PAGESIZE);
+	card = (size_t)((char *)addr - (char *)node) / page;
+	if (node->cards && addr && card < node->mapped / page)
+		node->cards[card] = 1;
+	else if (node->cards)
+		gc_memset(node->cards, 1, node->mapped / page);
+	node->dirty = 1;
+}
+
+//!/* Sets the dirty flag and every card of the block to value */
+void	gc_large_cards_fill(t_collecter *node, int value)
+{
+	node->dirty = value;
+	if (node->cards)
+		gc_memset(node->cards, value,
+			node->mapped / (size_t)sysconf(_SC_PAGESIZE));
+}
+
+//!/* mremap changed the number of kernel pages; without a card table the */
+//!/* block falls back to its dirty flag */
+void	gc_large_cards_resize(t_collecter *node)
+{
+	unsigned char	*cards;
+
+	cards = realloc(node->cards, node->mapped / (size_t)sysconf(_SC_PAGESIZE));
+	if (!cards)
+		free(node->cards);
+	node->cards = cards;
+	gc_large_cards_fill(node, node->dirty);
+}
+
+//!/* Cleaning takes the card and protects its page again, the header page */
+//!/* aside: it is never protected. A store racing with it faults anew */
+static void	push_card(t_collecter *node, size_t card, size_t page, int clean)
+{
+	char	*start;
+	char	*end;
+
+	start = (char *)node + card * page;
+	end = start + page;
+	if (clean && card > 0 && get_gc_concurrent()->protecting
+		&& mprotect(start, page, PROT_READ) != 0)
+		gc_large_dirty(node, start);
+	if (start < (char *)(node + 1))
+		start = (char *)(node + 1);
+	if (end > (char *)(node + 1) + node->size)
+		end = (char *)(node + 1) + node->size;
+	if (start < end)
+		gc_mark_stack_push(start, (size_t)(end - start), node->flags);
+}
+
+//!/* Pushes the dirty pages of the block on the mark stack, clipped to its */
+//!/* data; clean also clears their cards. Returns 0 if the whole block must */
+//!/* be scanned: it has no cards, or it is typed and can't be split */
+int	gc_large_cards_push(t_collecter *node, int clean)
+{
+	size_t	page;
+	size_t	card;
+
+	if (!node->cards || (node->flags & GC_FLAG_TYPED))
+		return (0);
+	page = (size_t)sysconf(_SC_PAGESIZE);
+	card = 0;
+	while (card < node->mapped / page)
+	{
+		if (!clean && node->cards[card])
+			push_card(node, card, page, 0);
+		else if (clean && __atomic_exchange_n(&node->cards[card], 0,
+				__ATOMIC_ACQ_REL))
+			push_card(node, card, page, 1);
+		card++;
+	}
+	return (1);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_large_remap.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:26:50 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:04:14 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "internal_collector.h"
+#include <sys/mman.h>
+
+//!/* Only the address of old is compared: its mapping may be gone. The */
+//!/* links moved with the header, its neighbours are pointed at it, and */
+//!/* so are the block set and a sample of the profiler */
+static void	relink(t_collecter *old, t_collecter *moved)
+{
+	t_gc_heap	*heap;
+
+	if (old == moved)
+		return ;
+	if (moved->prev)
+		moved->prev->next = moved;
+	else
+		*get_gc_head() = moved;
+	if (moved->next)
+		moved->next->prev = moved;
+	heap = get_gc_heap();
+	if (heap->large_cursor == &old->next)
+		heap->large_cursor = &moved->next;
+	get_gc_index()->valid = 0;
+	gc_blocks_remove(old);
+	gc_blocks_add(moved);
+	gc_profile_move(old + 1, moved + 1);
+}
+
+//!/* The kernel moves the pages instead of copying them */
+static void	*remap_block(t_collecter *header, size_t size)
+{
+	t_collecter	*moved;
+	size_t		length;
+
+	if (size > header->size && !gc_policy_admit(size - header->size))
+		return (NULL);
+	length = gc_large_length(size);
+	moved = mremap(header, header->mapped, length, MREMAP_MAYMOVE);
+	if (moved == MAP_FAILED)
+		return (NULL);
+	get_gc_heap()->large_bytes += length - moved->mapped;
+	gc_stats_heap_grew();
+	if (size > moved->size)
+		get_gc_heap()->allocated_bytes += size - moved->size;
+	moved->size = size;
+	moved->mapped = length;
+	gc_large_cards_resize(moved);
+	relink(header, moved);
+	return ((void *)(moved + 1));
+}
+
+//!/* NULL when ptr is not a mapped block that may stay one at this size; */
+//!/* typed blocks are left to the copy, their layout sits at the end */
+//!/* Shrinking never moves the block and returns its tail to the kernel */
+//!/* During a concurrent mark the markers may be reading the block */
+void	*gc_large_remap(void *ptr, size_t size)
+{
+	t_collecter	*header;
+	void		*moved;
+
+	if (size > (size_t)-1 - sizeof(t_collecter) - GC_PAGE_SIZE)
+		return (NULL);
+	moved = NULL;
+	gc_lock();
+	header = get_header_from_ptr(ptr);
+	if (!gc_page_find(ptr) && header->mapped
+		&& !(header->flags & GC_FLAG_TYPED) && !get_gc_concurrent()->active
+		&& (size >= get_gc_config()->large_threshold || size < header->size))
+		moved = remap_block(header, size);
+	gc_unlock();
+	return (moved);
+}
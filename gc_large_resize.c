@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_large_resize.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:08:52 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:08:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <malloc.h>
+
+//!/* Bytes the block can hold past its header. malloc may round up, and */
+//!/* gc_large_reserve and in-place shrinks leave more than header->size */
+size_t	gc_large_capacity(t_collecter *header)
+{
+	if (header->mapped)
+		return (header->mapped - sizeof(t_collecter));
+	return (malloc_usable_size(header) - sizeof(t_collecter));
+}
+
+//!/* Malloc'd blocks stay in place while the new size uses at least half */
+//!/* of their capacity. Typed ones keep their layout at the end and move */
+int	gc_large_resize(void *ptr, size_t size)
+{
+	t_collecter	*header;
+	size_t		capacity;
+	int			fits;
+
+	gc_lock();
+	header = get_header_from_ptr(ptr);
+	fits = 0;
+	if (!header->mapped && !(header->flags & GC_FLAG_TYPED))
+	{
+		capacity = gc_large_capacity(header);
+		fits = (size <= capacity && size >= capacity / 2);
+	}
+	if (fits)
+		header->size = size;
+	gc_unlock();
+	return (fits);
+}
+
+//!/* A malloc'd block that grows by reallocation gets half as much again */
+//!/* in reserve, which later growth takes without a copy. Mapped blocks */
+//!/* grow with mremap instead and get none */
+void	*gc_large_reserve(size_t size, unsigned char flags)
+{
+	void	*ptr;
+	size_t	reserve;
+
+	reserve = size + size / 2;
+	if (size <= GC_SMALL_MAX || (flags & GC_FLAG_TYPED) || reserve < size
+		|| reserve >= get_gc_config()->large_threshold)
+		return (gc_alloc(size, flags));
+	ptr = gc_alloc(reserve, flags);
+	if (!ptr)
+		return (gc_alloc(size, flags));
+	gc_lock();
+	get_header_from_ptr(ptr)->size = size;
+	gc_unlock();
+	return (ptr);
+}
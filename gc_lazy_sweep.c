@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_lazy_sweep.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:00:41 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:37:09 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+void	gc_set_lazy_sweep(int enable)
+{
+	gc_lock();
+	if (!enable)
+		gc_sweep_finish();
+	get_gc_config()->lazy_sweep = (enable != 0);
+	gc_unlock();
+}
+
+//!/* Nothing is freed here; allocation and gc_sweep_step do the work */
+//!/* A minor collection only marked the young survivors */
+void	gc_sweep_lazy(void)
+{
+	t_gc_heap	*heap;
+
+	heap = get_gc_heap();
+	if (!heap->minor)
+		heap->live_bytes = 0;
+	heap->live_bytes += heap->marked_bytes;
+	heap->allocated_bytes = 0;
+	heap->sweep_kind = 0;
+	heap->sweep_class = 0;
+	heap->sweep_cursor = heap->pages[0][0];
+	heap->large_cursor = get_gc_head();
+	gc_heap_rewind();
+	get_gc_index()->valid = 0;
+}
+
+void	gc_sweep_finish(void)
+{
+	size_t	budget;
+
+	budget = (size_t)-1;
+	if (get_gc_heap()->unswept > 0)
+		gc_sweep_pages();
+	gc_sweep_large_blocks(&budget);
+}
+
+static t_gc_page	*next_unswept_page(t_gc_heap *heap)
+{
+	while (heap->sweep_kind < GC_KIND_COUNT)
+	{
+		while (heap->sweep_cursor
+			&& heap->sweep_cursor->sweep_epoch == heap->epoch)
+			heap->sweep_cursor = heap->sweep_cursor->next;
+		if (heap->sweep_cursor)
+			return (heap->sweep_cursor);
+		heap->sweep_class++;
+		if (heap->sweep_class == GC_CLASS_COUNT)
+		{
+			heap->sweep_class = 0;
+			heap->sweep_kind++;
+		}
+		if (heap->sweep_kind < GC_KIND_COUNT)
+			heap->sweep_cursor
+				= heap->pages[heap->sweep_kind][heap->sweep_class];
+	}
+	return (NULL);
+}
+
+//!/* Budget counts pages and large blocks; empty pages go once all are swept */
+int	gc_sweep_step(size_t budget)
+{
+	t_gc_heap			*heap;
+	int					pending;
+	unsigned long long	start;
+
+	gc_lock();
+	start = gc_now_ns();
+	heap = get_gc_heap();
+	gc_sweep_large_blocks(&budget);
+	if (heap->unswept > 0)
+	{
+		while (budget > 0 && next_unswept_page(heap))
+		{
+			gc_page_sweep(heap->sweep_cursor);
+			budget--;
+		}
+		if (heap->unswept == 0 || !next_unswept_page(heap))
+		{
+			heap->unswept = 0;
+			gc_sweep_pages();
+		}
+	}
+	pending = (heap->unswept > 0 || heap->large_cursor != NULL);
+	get_gc_stats_state()->sweep_ns += gc_now_ns() - start;
+	gc_unlock();
+	return (pending);
+}
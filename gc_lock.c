@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_lock.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:04:59 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:01:52 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static pthread_mutex_t	*get_gc_mutex(void)
+{
+	static pthread_mutex_t	mutex;
+
+	return (&mutex);
+}
+
+static void	init_mutex(void)
+{
+	pthread_mutexattr_t	attr;
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(get_gc_mutex(), &attr);
+	pthread_mutexattr_destroy(&attr);
+}
+
+//!/* Recursive: a slow path holding the lock may trigger gc_collect */
+void	gc_lock(void)
+{
+	static pthread_once_t	once = PTHREAD_ONCE_INIT;
+
+	pthread_once(&once, init_mutex);
+	pthread_mutex_lock(get_gc_mutex());
+}
+
+//!/* Only called once gc_lock has set the mutex up */
+int	gc_trylock(void)
+{
+	return (pthread_mutex_trylock(get_gc_mutex()) == 0);
+}
+
+void	gc_unlock(void)
+{
+	pthread_mutex_unlock(get_gc_mutex());
+}
@@ -6,26 +6,69 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 16:57:16 by akivam            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 02:04:14 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "internal_collector.h"
 
-void	*gc_malloc(size_t size)
+//!/* Blocks past the large threshold get a mapping of their own */
+static t_collecter	*new_block(size_t size)
+{
+	t_collecter	*header;
+
+	*get_gc_fresh() = (size >= get_gc_config()->large_threshold);
+	if (*get_gc_fresh())
+		return (gc_large_map(size));
+	header = malloc(sizeof(t_collecter) + size);
+	if (header)
+	{
+		header->mapped = 0;
+		header->cards = NULL;
+	}
+	return (header);
+}
+
+//!/* While a lazy sweep or a concurrent mark is pending blocks start marked */
+//!/* so it keeps them, and dirty so a minor collection or the final pause */
+//!/* scans them. The markers' index stays as it is during a mark */
+void	gc_large_link(t_collecter *node, size_t size, unsigned char flags)
 {
 	t_collecter	**head_ptr;
+
+	head_ptr = get_gc_head();
+	node->is_marked = (get_gc_heap()->large_cursor != NULL
+			|| get_gc_concurrent()->active);
+	node->flags = flags;
+	gc_large_cards_fill(node, node->is_marked);
+	node->size = size;
+	node->prev = NULL;
+	node->next = *head_ptr;
+	if (*head_ptr)
+		(*head_ptr)->prev = node;
+	*head_ptr = node;
+	gc_blocks_add(node);
+	get_gc_heap()->large_bytes += gc_large_footprint(node);
+	gc_stats_heap_grew();
+	if (!get_gc_concurrent()->active)
+		get_gc_index()->valid = 0;
+}
+
+//!/* Blocks above GC_SMALL_MAX keep a header and live on the block list */
+void	*gc_alloc_large(size_t size, unsigned char flags)
+{
 	t_collecter	*new_header;
 
-	if (size == 0)
+	if (size > (size_t)-1 - sizeof(t_collecter) - GC_PAGE_SIZE)
 		return (NULL);
-	new_header = malloc(sizeof(t_collecter) + size);
+	new_header = new_block(size);
 	if (!new_header)
 		return (NULL);
-	head_ptr = get_gc_head();
-	new_header->is_marked = 0;
-	new_header->size = size;
-	new_header->next = *head_ptr;
-	*head_ptr = new_header;
+	gc_large_link(new_header, size, flags);
 	return ((void *)(new_header + 1));
 }
+
+void	*gc_malloc(size_t size)
+{
+	return (gc_profile_note(gc_alloc(size, 0), size));
+}
@@ -6,70 +6,87 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 20:34:08 by harici            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 23:37:09 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "internal_collector.h"
 
-void	mark_pointer(void *ptr)
+//!/* Non-null words that resolve to nothing count as misses for the stats */
+static void	mark_large(void *ptr)
 {
-	t_collecter	**head_ptr;
-	t_collecter	*node;
-	void		*data_ptr;
+	t_gc_mark_stack	*stack;
+	t_collecter		*node;
 
-	head_ptr = get_gc_head();
-	node = *head_ptr;
-	while (node)
+	stack = get_gc_mark_stack();
+	node = gc_index_find(ptr);
+	if (!node && ptr)
+		stack->misses++;
+	if (node && !node->is_marked
+		&& !__atomic_exchange_n(&node->is_marked, 1, __ATOMIC_ACQ_REL))
 	{
-		data_ptr = (void *)(node + 1);
-		if (ptr == data_ptr && !node->is_marked)
-		{
-			node->is_marked = 1;
-			mark_memory_region(data_ptr, node->size);
-			break ;
-		}
-		node = node->next;
+		stack->marked_bytes += sizeof(t_collecter) + node->size;
+		stack->marked_objects++;
+		if (!(node->flags & GC_FLAG_ATOMIC))
+			gc_mark_stack_push((void *)(node + 1), node->size, node->flags);
 	}
 }
 
+//!/* Marks are set atomically: only the marker that sets one pushes it */
+//!/* Atomic objects are marked but never pushed: they hold no pointers */
+static void	mark_slot(t_gc_page *page, size_t slot)
+{
+	t_gc_mark_stack	*stack;
+	unsigned long	bit;
+	unsigned long	*word;
+
+	bit = 1UL << (slot % GC_WORD_BITS);
+	word = &page->mark_bits[slot / GC_WORD_BITS];
+	if ((*word & bit)
+		|| (__atomic_fetch_or(word, bit, __ATOMIC_ACQ_REL) & bit))
+		return ;
+	stack = get_gc_mark_stack();
+	stack->marked_bytes += page->obj_size;
+	stack->marked_objects++;
+	if (!(page->flags & GC_FLAG_ATOMIC))
+		gc_mark_stack_push(page->base + slot * page->obj_size,
+			page->obj_size, page->flags);
+}
+
+//!/* Small objects are looked up in the page map, large ones in the index */
+void	mark_pointer(void *ptr)
+{
+	t_gc_page		*page;
+	size_t			slot;
+
+	page = gc_page_find(ptr);
+	if (!page)
+		mark_large(ptr);
+	else if (gc_page_slot(page, ptr, &slot))
+		mark_slot(page, slot);
+	else
+		get_gc_mark_stack()->misses++;
+}
+
 //!/* Scan at pointer-aligned boundaries for efficiency*/
+//!/* The heap filter's kernel only looks up words that may be pointers */
 void	mark_memory_region(void *start, size_t size)
 {
-	size_t	i;
-	void	**potential_ptr;
+	t_gc_filter	*filter;
 
-	i = 0;
-	while (i + sizeof(void *) <= size)
-	{
-		potential_ptr = (void **)((char *)start + i);
-		if (is_valid_pointer(*potential_ptr))
-			mark_pointer(*potential_ptr);
-		i += sizeof(void *);
-	}
+	filter = &get_gc_heap()->filter;
+	filter->scan((void **)start, size / sizeof(void *), filter);
 }
 
 int	is_valid_pointer(void *ptr)
 {
-	t_collecter	**head_ptr;
-	t_collecter	*node;
-	void		*data_ptr;
+	t_gc_page	*page;
+	size_t		slot;
 
 	if (!ptr)
 		return (0);
-	head_ptr = get_gc_head();
-	node = *head_ptr;
-	while (node)
-	{
-		data_ptr = (void *)(node + 1);
-		if (ptr == data_ptr)
-			return (1);
-		node = node->next;
-	}
-	return (0);
-}
-
-void	gc_mark(void)
-{
-	mark_from_stack();
+	page = gc_page_find(ptr);
+	if (page)
+		return (gc_page_slot(page, ptr, &slot));
+	return (gc_index_find(ptr) != NULL);
 }
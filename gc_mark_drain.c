@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_mark_drain.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:52:41 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:46:23 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	rescan_page(t_gc_page *page)
+{
+	size_t	slot;
+
+	slot = 0;
+	while (slot < page->obj_count)
+	{
+		if (page->mark_bits[slot / GC_WORD_BITS]
+			& (1UL << (slot % GC_WORD_BITS)))
+			gc_scan_object(page->base + slot * page->obj_size,
+				page->obj_size, page->flags);
+		slot++;
+	}
+}
+
+//!/* Pushes the unmarked children of every marked object */
+static void	rescan_marked_objects(void)
+{
+	t_collecter	*node;
+
+	gc_heap_for_each_page(rescan_page);
+	node = *get_gc_head();
+	while (node)
+	{
+		if (node->is_marked)
+			gc_scan_object((void *)(node + 1), node->size, node->flags);
+		node = node->next;
+	}
+}
+
+//!/* Scans grey objects until none are left, rescanning after overflows */
+void	gc_mark_drain(void)
+{
+	t_gc_mark_stack	*stack;
+	t_gc_grey		grey;
+
+	stack = get_gc_mark_stack();
+	while (1)
+	{
+		while (gc_mark_stack_pop(&grey))
+			gc_scan_object(grey.start, grey.size, grey.flags);
+		if (!stack->overflowed)
+			return ;
+		stack->overflowed = 0;
+		rescan_marked_objects();
+	}
+}
+
+//!/* Stops at the deadline, checked every GC_STEP_CHUNK bytes scanned, */
+//!/* with the rest still grey. Untyped objects are scanned that much at a */
+//!/* time, the remainder going back on the stack. Returns 1 once none are */
+//!/* left */
+int	gc_mark_drain_until(unsigned long long deadline)
+{
+	t_gc_grey	grey;
+	size_t		scanned;
+
+	scanned = 0;
+	while (gc_mark_stack_pop(&grey))
+	{
+		if (!(grey.flags & GC_FLAG_TYPED) && grey.size > GC_STEP_CHUNK)
+		{
+			gc_mark_stack_push((char *)grey.start + GC_STEP_CHUNK,
+				grey.size - GC_STEP_CHUNK, grey.flags);
+			grey.size = GC_STEP_CHUNK;
+		}
+		gc_scan_object(grey.start, grey.size, grey.flags);
+		scanned += grey.size;
+		if (scanned >= GC_STEP_CHUNK && gc_now_ns() >= deadline)
+			return (0);
+		if (scanned >= GC_STEP_CHUNK)
+			scanned = 0;
+	}
+	if (get_gc_mark_stack()->overflowed)
+		gc_mark_drain();
+	return (1);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_mark_parallel.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:48 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:37:09 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	run_helpers(t_gc_markers *markers)
+{
+	pthread_mutex_lock(&markers->mutex);
+	markers->finished = 0;
+	__atomic_store_n(&markers->active, markers->started + 1,
+		__ATOMIC_RELEASE);
+	markers->generation++;
+	pthread_cond_broadcast(&markers->wake);
+	pthread_mutex_unlock(&markers->mutex);
+	gc_mark_work(0);
+	pthread_mutex_lock(&markers->mutex);
+	while (markers->finished < markers->started)
+		pthread_cond_wait(&markers->done, &markers->mutex);
+	pthread_mutex_unlock(&markers->mutex);
+}
+
+//!/* Folds the helpers' counters and overflow flags into the caller's deque */
+static void	merge_helpers(t_gc_markers *markers)
+{
+	t_gc_mark_stack	*own;
+	t_gc_mark_stack	*stack;
+	size_t			i;
+
+	own = get_gc_mark_stack();
+	i = 1;
+	while (i <= markers->started)
+	{
+		stack = markers->stacks[i];
+		own->marked_bytes += stack->marked_bytes;
+		own->marked_objects += stack->marked_objects;
+		own->misses += stack->misses;
+		stack->marked_bytes = 0;
+		stack->marked_objects = 0;
+		stack->misses = 0;
+		if (stack->overflowed)
+			own->overflowed = 1;
+		stack->overflowed = 0;
+		i++;
+	}
+}
+
+//!/* Drains the roots' grey objects; overflow rescans stay serial */
+//!/* Returns the bytes marked by every marker and resets the counters */
+size_t	gc_mark_parallel(void)
+{
+	t_gc_markers	*markers;
+	t_gc_mark_stack	*stack;
+	size_t			marked;
+
+	markers = get_gc_markers();
+	if (markers->started > 0)
+	{
+		run_helpers(markers);
+		merge_helpers(markers);
+	}
+	gc_mark_drain();
+	stack = get_gc_mark_stack();
+	marked = stack->marked_bytes;
+	stack->marked_bytes = 0;
+	return (marked);
+}
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_mark_phase.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:50:57 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Runs before the world stops: it frees memory and may call malloc */
+void	gc_mark_prepare(void)
+{
+	gc_sweep_finish();
+	gc_generation_begin();
+	gc_index_build();
+	gc_filter_update();
+	gc_roots_refresh();
+	gc_markers_start();
+}
+
+//!/* Counts buffered in the TLABs predate the cycle and are dropped; they */
+//!/* belong to the default instance */
+static void	discard_thread_counters(void)
+{
+	t_gc_thread	*thread;
+
+	if (*get_gc_current())
+		return ;
+	thread = get_gc_world()->threads;
+	while (thread)
+	{
+		thread->allocated = 0;
+		thread = thread->next;
+	}
+}
+
+//!/* Runs with the world stopped, once every marker has finished */
+void	gc_mark_publish(size_t marked_bytes)
+{
+	t_gc_heap	*heap;
+
+	heap = get_gc_heap();
+	heap->marked_bytes = marked_bytes;
+	gc_stats_mark_done();
+	heap->epoch++;
+	heap->unswept = heap->page_count;
+	discard_thread_counters();
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_mark_stack.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:52:41 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:21:58 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Slots below bottom were stolen; reclaiming them avoids a resize */
+static void	compact_mark_stack(t_gc_mark_stack *stack)
+{
+	gc_memmove(stack->items, stack->items + stack->bottom,
+		(stack->top - stack->bottom) * sizeof(t_gc_grey));
+	stack->top -= stack->bottom;
+	stack->bottom = 0;
+}
+
+//!/* Backed by mmap: it grows while threads that may hold malloc's locks */
+//!/* are suspended */
+static int	grow_mark_stack(t_gc_mark_stack *stack)
+{
+	t_gc_grey	*items;
+	size_t		capacity;
+
+	if (stack->bottom > 0)
+	{
+		compact_mark_stack(stack);
+		return (1);
+	}
+	capacity = stack->capacity * 2;
+	if (capacity == 0)
+		capacity = GC_MARK_STACK_MIN;
+	if (capacity > GC_MARK_STACK_MAX)
+		return (0);
+	items = gc_os_map(capacity * sizeof(t_gc_grey));
+	if (!items)
+		return (0);
+	if (stack->items)
+	{
+		gc_memcpy(items, stack->items, stack->top * sizeof(t_gc_grey));
+		gc_os_unmap(stack->items, stack->capacity * sizeof(t_gc_grey));
+	}
+	stack->items = items;
+	stack->capacity = capacity;
+	return (1);
+}
+
+//!/* An object that can't be pushed stays marked; gc_mark_drain rescans it */
+void	gc_mark_stack_push(void *start, size_t size, unsigned char flags)
+{
+	t_gc_mark_stack	*stack;
+
+	stack = get_gc_mark_stack();
+	gc_mark_stack_lock(stack);
+	if (stack->top == stack->capacity && !grow_mark_stack(stack))
+		stack->overflowed = 1;
+	else
+	{
+		stack->items[stack->top].start = start;
+		stack->items[stack->top].size = size;
+		stack->items[stack->top].flags = flags;
+		stack->top++;
+	}
+	gc_mark_stack_unlock(stack);
+}
+
+//!/* Prefetches the object popped next while this one is being scanned */
+int	gc_mark_stack_pop(t_gc_grey *grey)
+{
+	t_gc_mark_stack	*stack;
+
+	stack = get_gc_mark_stack();
+	gc_mark_stack_lock(stack);
+	if (stack->top == stack->bottom)
+	{
+		gc_mark_stack_unlock(stack);
+		return (0);
+	}
+	stack->top--;
+	*grey = stack->items[stack->top];
+	if (stack->top > stack->bottom)
+		__builtin_prefetch(stack->items[stack->top - 1].start);
+	else
+	{
+		stack->top = 0;
+		stack->bottom = 0;
+	}
+	gc_mark_stack_unlock(stack);
+	return (1);
+}
+
+void	gc_mark_stack_release(void)
+{
+	t_gc_mark_stack	*stack;
+
+	stack = get_gc_mark_stack();
+	if (stack->items)
+		gc_os_unmap(stack->items, stack->capacity * sizeof(t_gc_grey));
+	stack->items = NULL;
+	stack->bottom = 0;
+	stack->top = 0;
+	stack->capacity = 0;
+	stack->overflowed = 0;
+}
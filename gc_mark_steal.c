@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_mark_steal.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:37 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:12:37 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Test-and-test-and-set: waiters spin on a shared cache line copy */
+void	gc_mark_stack_lock(t_gc_mark_stack *stack)
+{
+	while (__atomic_exchange_n(&stack->lock, 1, __ATOMIC_ACQUIRE))
+	{
+		while (__atomic_load_n(&stack->lock, __ATOMIC_RELAXED))
+			;
+	}
+}
+
+void	gc_mark_stack_unlock(t_gc_mark_stack *stack)
+{
+	__atomic_store_n(&stack->lock, 0, __ATOMIC_RELEASE);
+}
+
+//!/* Takes the oldest grey object, usually the root of the largest subgraph */
+int	gc_mark_stack_steal(t_gc_mark_stack *victim, t_gc_grey *grey)
+{
+	if (__atomic_load_n(&victim->top, __ATOMIC_RELAXED)
+		== __atomic_load_n(&victim->bottom, __ATOMIC_RELAXED))
+		return (0);
+	gc_mark_stack_lock(victim);
+	if (victim->top == victim->bottom)
+	{
+		gc_mark_stack_unlock(victim);
+		return (0);
+	}
+	*grey = victim->items[victim->bottom];
+	victim->bottom++;
+	if (victim->bottom == victim->top)
+	{
+		victim->bottom = 0;
+		victim->top = 0;
+	}
+	gc_mark_stack_unlock(victim);
+	return (1);
+}
@@ -6,42 +6,54 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 21:01:37 by harici            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 01:15:14 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "internal_collector.h"
 
-static void	scan_stack_range(void *start, void *end)
+static void	scan_stack_range(void (*fn)(void *, size_t), void *start,
+		void *end)
 {
 	void	**current;
 
-	current = (void **)start;
-	while (current < (void **)end)
-	{
-		if (is_valid_pointer(*current))
-			mark_pointer(*current);
-		current++;
-	}
+	current = (void **)((uintptr_t)start & ~(uintptr_t)(sizeof(void *) - 1));
+	if (current < (void **)end)
+		fn(current, (char *)end - (char *)current);
 }
 
 //!/* Supports both stack growth directions (up and down) */
-void	mark_from_stack(void)
+static void	scan_stack_between(void (*fn)(void *, size_t), void *top,
+		void *base)
+{
+	if (top > base)
+		scan_stack_range(fn, base, top);
+	else
+		scan_stack_range(fn, top, base);
+}
+
+//!/* Callee-saved registers are spilled into this frame before the scan; */
+//!/* suspended threads spilled theirs in gc_thread_park, above stack_ptr */
+void	gc_stacks_for_each(void (*fn)(void *, size_t))
 {
-	void	**stack_start_ptr;
-	void	*stack_start;
-	void	*stack_end;
-	int		stack_var;
-	void	*temp;
+	t_gc_thread	*self;
+	t_gc_thread	*thread;
+	int			stack_var;
 
-	stack_start_ptr = get_gc_stack_start();
-	stack_start = *stack_start_ptr;
-	stack_end = &stack_var;
-	if (stack_start > stack_end)
+	__builtin_unwind_init();
+	self = *get_gc_thread_self();
+	thread = get_gc_world()->threads;
+	while (thread)
 	{
-		temp = stack_start;
-		stack_start = stack_end;
-		stack_end = temp;
+		if (thread == self)
+			scan_stack_between(fn, &stack_var, thread->stack_base);
+		else if (thread->stack_ptr)
+			scan_stack_between(fn, thread->stack_ptr, thread->stack_base);
+		thread = thread->next;
 	}
-	scan_stack_range(stack_start, stack_end);
+}
+
+void	mark_from_stack(void)
+{
+	gc_stacks_for_each(mark_memory_region);
 }
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_mark_work.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:13:08 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:21:58 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <sched.h>
+
+static int	steal_any(size_t index, t_gc_grey *grey)
+{
+	t_gc_markers	*markers;
+	t_gc_mark_stack	*victim;
+	size_t			count;
+	size_t			i;
+
+	markers = get_gc_markers();
+	count = markers->started + 1;
+	i = 1;
+	while (i < count)
+	{
+		victim = markers->stacks[(index + i) % count];
+		if (victim && gc_mark_stack_steal(victim, grey))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+static int	work_visible(void)
+{
+	t_gc_markers	*markers;
+	t_gc_mark_stack	*stack;
+	size_t			i;
+
+	markers = get_gc_markers();
+	i = 0;
+	while (i <= markers->started)
+	{
+		stack = markers->stacks[i];
+		if (stack && __atomic_load_n(&stack->top, __ATOMIC_RELAXED)
+			!= __atomic_load_n(&stack->bottom, __ATOMIC_RELAXED))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+//!/* All markers idle means every deque is empty: only active ones push */
+static int	wait_for_work(size_t index, t_gc_grey *grey)
+{
+	t_gc_markers	*markers;
+
+	markers = get_gc_markers();
+	__atomic_sub_fetch(&markers->active, 1, __ATOMIC_ACQ_REL);
+	while (__atomic_load_n(&markers->active, __ATOMIC_ACQUIRE) > 0)
+	{
+		if (work_visible())
+		{
+			__atomic_add_fetch(&markers->active, 1, __ATOMIC_ACQ_REL);
+			if (steal_any(index, grey))
+				return (1);
+			__atomic_sub_fetch(&markers->active, 1, __ATOMIC_ACQ_REL);
+		}
+		sched_yield();
+	}
+	return (0);
+}
+
+//!/* Same scanning rules as the serial drain, on the marker's own deque */
+void	gc_mark_work(size_t index)
+{
+	t_gc_grey	grey;
+
+	while (1)
+	{
+		while (gc_mark_stack_pop(&grey))
+			gc_scan_object(grey.start, grey.size, grey.flags);
+		if (!steal_any(index, &grey) && !wait_for_work(index, &grey))
+			return ;
+		gc_scan_object(grey.start, grey.size, grey.flags);
+	}
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_markers.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:13:39 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	init_sync(t_gc_markers *markers)
+{
+	pthread_mutex_init(&markers->mutex, NULL);
+	pthread_cond_init(&markers->wake, NULL);
+	pthread_cond_init(&markers->done, NULL);
+	markers->sync = 1;
+}
+
+//!/* Called with the mutex held; returns 0 once shutdown is requested */
+static int	serve_generation(t_gc_markers *markers, size_t index,
+		size_t *generation)
+{
+	while (!markers->shutdown && markers->generation == *generation)
+		pthread_cond_wait(&markers->wake, &markers->mutex);
+	if (markers->shutdown)
+		return (0);
+	*generation = markers->generation;
+	pthread_mutex_unlock(&markers->mutex);
+	gc_mark_work(index);
+	pthread_mutex_lock(&markers->mutex);
+	markers->finished++;
+	pthread_cond_signal(&markers->done);
+	return (1);
+}
+
+//!/* Helpers are not registered: they hold no roots and are never stopped */
+//!/* arg is the instance they mark for; they number themselves from 1 */
+static void	*marker_main(void *arg)
+{
+	t_gc_markers	*markers;
+	t_gc_mark_stack	stack;
+	size_t			generation;
+	size_t			index;
+
+	gc_instance_switch(arg);
+	markers = get_gc_markers();
+	gc_memset(&stack, 0, sizeof(stack));
+	*get_gc_marker_self() = &stack;
+	pthread_mutex_lock(&markers->mutex);
+	index = ++markers->ready;
+	markers->stacks[index] = &stack;
+	generation = markers->generation;
+	pthread_cond_signal(&markers->done);
+	while (serve_generation(markers, index, &generation))
+		;
+	markers->stacks[index] = NULL;
+	pthread_mutex_unlock(&markers->mutex);
+	gc_mark_stack_release();
+	return (NULL);
+}
+
+//!/* Called with the lock held, before the world stops: pthread_create */
+//!/* allocates. Restarts the pool when gc_set_mark_threads changed it */
+void	gc_markers_start(void)
+{
+	t_gc_markers	*markers;
+	size_t			wanted;
+
+	markers = get_gc_markers();
+	if (!markers->sync)
+		init_sync(markers);
+	wanted = get_gc_config()->mark_threads - 1;
+	if (markers->started == wanted)
+		return ;
+	gc_markers_stop();
+	markers->stacks[0] = get_gc_mark_stack();
+	while (markers->started < wanted
+		&& pthread_create(&markers->threads[markers->started + 1], NULL,
+			marker_main, *get_gc_current()) == 0)
+		markers->started++;
+	pthread_mutex_lock(&markers->mutex);
+	while (markers->ready < markers->started)
+		pthread_cond_wait(&markers->done, &markers->mutex);
+	pthread_mutex_unlock(&markers->mutex);
+}
+
+void	gc_markers_stop(void)
+{
+	t_gc_markers	*markers;
+
+	markers = get_gc_markers();
+	if (markers->started == 0)
+		return ;
+	pthread_mutex_lock(&markers->mutex);
+	markers->shutdown = 1;
+	pthread_cond_broadcast(&markers->wake);
+	pthread_mutex_unlock(&markers->mutex);
+	while (markers->started > 0)
+	{
+		pthread_join(markers->threads[markers->started], NULL);
+		markers->started--;
+	}
+	markers->shutdown = 0;
+	markers->ready = 0;
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_memory_avx2.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:31:11 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:17:37 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+#if defined(__x86_64__)
+
+# include <immintrin.h>
+
+//!/* The SSE2 kernels with 32-byte vectors; used when the CPU has AVX2 */
+__attribute__((target("avx2")))
+void	gc_mem_set_avx2(void *dst, int c, size_t n)
+{
+	unsigned char	*d;
+	__m256i			fill;
+	size_t			i;
+
+	if (n < 32)
+	{
+		gc_mem_set_words(dst, c, n);
+		return ;
+	}
+	d = dst;
+	fill = _mm256_set1_epi8((char)c);
+	_mm256_storeu_si256((__m256i *)d, fill);
+	i = 32 - ((uintptr_t)d & 31);
+	while (i + 32 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i), fill);
+		i += 32;
+	}
+	_mm256_storeu_si256((__m256i *)(d + n - 32), fill);
+}
+
+__attribute__((target("avx2")))
+void	gc_mem_copy_avx2(void *dst, const void *src, size_t n)
+{
+	unsigned char		*d;
+	const unsigned char	*s;
+	size_t				i;
+
+	if (n < 32)
+	{
+		gc_mem_copy_words(dst, src, n);
+		return ;
+	}
+	d = dst;
+	s = src;
+	_mm256_storeu_si256((__m256i *)d, _mm256_loadu_si256((const __m256i *)s));
+	i = 32 - ((uintptr_t)d & 31);
+	while (i + 32 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i),
+			_mm256_loadu_si256((const __m256i *)(s + i)));
+		i += 32;
+	}
+	_mm256_storeu_si256((__m256i *)(d + n - 32),
+		_mm256_loadu_si256((const __m256i *)(s + n - 32)));
+}
+
+__attribute__((target("avx2")))
+size_t	gc_mem_cmp_avx2(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	unsigned int		equal;
+	size_t				i;
+
+	a = s1;
+	b = s2;
+	i = 0;
+	while (i + 32 <= n)
+	{
+		equal = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+					_mm256_loadu_si256((const __m256i *)(a + i)),
+					_mm256_loadu_si256((const __m256i *)(b + i))));
+		if (equal != 0xFFFFFFFF)
+			return (i + __builtin_ctz(~equal));
+		i += 32;
+	}
+	return (i + gc_mem_cmp_words(a + i, b + i, n - i));
+}
+
+__attribute__((target("avx2")))
+size_t	gc_mem_chr_avx2(const void *s, int c, size_t n)
+{
+	const unsigned char	*str;
+	__m256i				needle;
+	unsigned int		found;
+	size_t				i;
+
+	if (n < 32)
+		return (gc_mem_chr_words(s, c, n));
+	str = s;
+	needle = _mm256_set1_epi8((char)c);
+	i = 0;
+	while (i + 32 <= n)
+	{
+		found = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+					_mm256_loadu_si256((const __m256i *)(str + i)), needle));
+		if (found)
+			return (i + __builtin_ctz(found));
+		i += 32;
+	}
+	return (i + gc_mem_chr_words(str + i, c, n - i));
+}
+
+#endif
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_memory_dispatch.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:31:11 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:17:37 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static t_gc_mem_kernels	*get_gc_mem_table(void)
+{
+	static t_gc_mem_kernels	kernels;
+
+	return (&kernels);
+}
+
+#if defined(__x86_64__)
+
+//!/* SSE2 is part of x86-64, AVX2 is detected at runtime */
+static void	select_simd(t_gc_mem_kernels *kernels)
+{
+	__builtin_cpu_init();
+	kernels->set = gc_mem_set_sse2;
+	kernels->copy = gc_mem_copy_sse2;
+	kernels->cmp = gc_mem_cmp_sse2;
+	kernels->chr = gc_mem_chr_sse2;
+	if (!__builtin_cpu_supports("avx2"))
+		return ;
+	kernels->set = gc_mem_set_avx2;
+	kernels->copy = gc_mem_copy_avx2;
+	kernels->cmp = gc_mem_cmp_avx2;
+	kernels->chr = gc_mem_chr_avx2;
+}
+
+#else
+
+//!/* Other targets keep the word kernels */
+static void	select_simd(t_gc_mem_kernels *kernels)
+{
+	(void)kernels;
+}
+
+#endif
+
+static void	init_kernels(void)
+{
+	t_gc_mem_kernels	*kernels;
+
+	kernels = get_gc_mem_table();
+	kernels->set = gc_mem_set_words;
+	kernels->copy = gc_mem_copy_words;
+	kernels->cmp = gc_mem_cmp_words;
+	kernels->chr = gc_mem_chr_words;
+	select_simd(kernels);
+}
+
+//!/* Picked once, on first use, for the CPU the process runs on. Once the */
+//!/* table is filled in, the flag spares later calls the pthread_once */
+const t_gc_mem_kernels	*gc_mem_kernels(void)
+{
+	static pthread_once_t	once = PTHREAD_ONCE_INIT;
+	static int				ready;
+
+	if (__atomic_load_n(&ready, __ATOMIC_ACQUIRE))
+		return (get_gc_mem_table());
+	pthread_once(&once, init_kernels);
+	__atomic_store_n(&ready, 1, __ATOMIC_RELEASE);
+	return (get_gc_mem_table());
+}
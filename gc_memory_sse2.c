@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_memory_sse2.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:31:11 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:17:37 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+#if defined(__x86_64__)
+
+# include <emmintrin.h>
+
+//!/* One unaligned head store, aligned stores, one unaligned tail store */
+__attribute__((target("sse2")))
+void	gc_mem_set_sse2(void *dst, int c, size_t n)
+{
+	unsigned char	*d;
+	__m128i			fill;
+	size_t			i;
+
+	if (n < 16)
+	{
+		gc_mem_set_words(dst, c, n);
+		return ;
+	}
+	d = dst;
+	fill = _mm_set1_epi8((char)c);
+	_mm_storeu_si128((__m128i *)d, fill);
+	i = 16 - ((uintptr_t)d & 15);
+	while (i + 16 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i), fill);
+		i += 16;
+	}
+	_mm_storeu_si128((__m128i *)(d + n - 16), fill);
+}
+
+//!/* Rewrites a few bytes twice, so the buffers must not overlap */
+__attribute__((target("sse2")))
+void	gc_mem_copy_sse2(void *dst, const void *src, size_t n)
+{
+	unsigned char		*d;
+	const unsigned char	*s;
+	size_t				i;
+
+	if (n < 16)
+	{
+		gc_mem_copy_words(dst, src, n);
+		return ;
+	}
+	d = dst;
+	s = src;
+	_mm_storeu_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+	i = 16 - ((uintptr_t)d & 15);
+	while (i + 16 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i),
+			_mm_loadu_si128((const __m128i *)(s + i)));
+		i += 16;
+	}
+	_mm_storeu_si128((__m128i *)(d + n - 16),
+		_mm_loadu_si128((const __m128i *)(s + n - 16)));
+}
+
+//!/* Never reads past n: the tail goes to the word kernel */
+__attribute__((target("sse2")))
+size_t	gc_mem_cmp_sse2(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	unsigned int		equal;
+	size_t				i;
+
+	a = s1;
+	b = s2;
+	i = 0;
+	while (i + 16 <= n)
+	{
+		equal = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_loadu_si128((const __m128i *)(a + i)),
+					_mm_loadu_si128((const __m128i *)(b + i))));
+		if (equal != 0xFFFF)
+			return (i + __builtin_ctz(~equal));
+		i += 16;
+	}
+	return (i + gc_mem_cmp_words(a + i, b + i, n - i));
+}
+
+__attribute__((target("sse2")))
+size_t	gc_mem_chr_sse2(const void *s, int c, size_t n)
+{
+	const unsigned char	*str;
+	__m128i				needle;
+	unsigned int		found;
+	size_t				i;
+
+	if (n < 16)
+		return (gc_mem_chr_words(s, c, n));
+	str = s;
+	needle = _mm_set1_epi8((char)c);
+	i = 0;
+	while (i + 16 <= n)
+	{
+		found = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_loadu_si128((const __m128i *)(str + i)), needle));
+		if (found)
+			return (i + __builtin_ctz(found));
+		i += 16;
+	}
+	return (i + gc_mem_chr_words(str + i, c, n - i));
+}
+
+#endif
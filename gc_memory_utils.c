@@ -6,30 +6,36 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 21:51:42 by akivam            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 02:17:37 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "internal_collector.h"
 
+//!/* Up to GC_MEM_INLINE bytes are handled here: a kernel call costs more */
 void	*gc_memset(void *s, int c, size_t n)
 {
+	unsigned char	*d;
 	size_t			i;
-	unsigned char	*tmp;
 
+	if (n > GC_MEM_INLINE)
+	{
+		gc_mem_kernels()->set(s, c, n);
+		return (s);
+	}
+	d = s;
 	i = 0;
-	tmp = s;
 	while (i < n)
 	{
-		tmp[i] = (unsigned char)c;
-		i = i + 1;
+		d[i] = (unsigned char)c;
+		i++;
 	}
 	return (s);
 }
 
+//!/* Overlapping buffers take the word kernel in the safe direction */
 void	*gc_memmove(void *dest, const void *src, size_t n)
 {
-	size_t			i;
 	unsigned char	*tmp_src;
 	unsigned char	*tmp_dst;
 
@@ -37,73 +43,70 @@ void	*gc_memmove(void *dest, const void *src, size_t n)
 	tmp_dst = (unsigned char *)dest;
 	if (n == 0 || tmp_src == tmp_dst)
 		return (dest);
-	if (tmp_src > tmp_dst)
-	{
-		i = 0;
-		while (i < n)
-		{
-			tmp_dst[i] = tmp_src[i];
-			i++;
-		}
-	}
+	if (tmp_dst + n <= tmp_src || tmp_src + n <= tmp_dst)
+		gc_memcpy(dest, src, n);
+	else if (tmp_src > tmp_dst)
+		gc_mem_copy_words(dest, src, n);
 	else
-	{
-		i = n;
-		while (i-- > 0)
-			tmp_dst[i] = tmp_src[i];
-	}
+		gc_mem_copy_words_back(dest, src, n);
 	return (dest);
 }
 
 void	*gc_memcpy(void *dest, const void *src, size_t n)
 {
-	size_t			i;
-	unsigned char	*tmp_src;
-	unsigned char	*tmp_dst;
+	unsigned char		*d;
+	const unsigned char	*s;
+	size_t				i;
 
-	tmp_src = (unsigned char *)src;
-	tmp_dst = dest;
-	if (!tmp_src || !tmp_dst)
+	if (!src || !dest)
 		return (NULL);
+	if (n > GC_MEM_INLINE)
+	{
+		gc_mem_kernels()->copy(dest, src, n);
+		return (dest);
+	}
+	d = dest;
+	s = src;
 	i = 0;
 	while (i < n)
 	{
-		tmp_dst[i] = tmp_src[i];
+		d[i] = s[i];
 		i++;
 	}
 	return (dest);
 }
 
+//!/* A kernel stops on the first difference, which the loop then keeps */
 int	gc_memcmp(const void *s1, const void *s2, size_t n)
 {
-	unsigned char	*str1;
-	unsigned char	*str2;
-	size_t			i;
+	const unsigned char	*a;
+	const unsigned char	*b;
+	size_t				i;
 
-	str1 = (unsigned char *)s1;
-	str2 = (unsigned char *)s2;
+	a = s1;
+	b = s2;
 	i = 0;
-	while (i < n)
-	{
-		if (str1[i] != str2[i])
-			return (str1[i] - str2[i]);
+	if (n > GC_MEM_INLINE)
+		i = gc_mem_kernels()->cmp(s1, s2, n);
+	while (i < n && a[i] == b[i])
 		i++;
-	}
-	return (0);
+	if (i == n)
+		return (0);
+	return (a[i] - b[i]);
 }
 
 void	*gc_memchr(const void *s1, int c, size_t n)
 {
-	size_t			i;
-	unsigned char	*str;
+	const unsigned char	*s;
+	size_t				i;
 
+	s = s1;
 	i = 0;
-	str = (unsigned char *)s1;
-	while (i < n)
-	{
-		if (str[i] == (unsigned char)c)
-			return (str + i);
+	if (n > GC_MEM_INLINE)
+		i = gc_mem_kernels()->chr(s1, c, n);
+	while (i < n && s[i] != (unsigned char)c)
 		i++;
-	}
-	return (NULL);
+	if (i == n)
+		return (NULL);
+	return ((void *)(s + i));
 }
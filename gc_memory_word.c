@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_memory_word.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:31:11 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:31:11 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Bytes up to the first aligned word, then whole aligned words */
+void	gc_mem_set_words(void *dst, int c, size_t n)
+{
+	unsigned char	*d;
+	size_t			pattern;
+	size_t			i;
+
+	d = dst;
+	pattern = (size_t)-1 / 0xFF * (unsigned char)c;
+	i = 0;
+	while (i < n && ((uintptr_t)(d + i) & (sizeof(size_t) - 1)))
+		d[i++] = (unsigned char)c;
+	while (i + sizeof(size_t) <= n)
+	{
+		*(t_gc_word *)(d + i) = pattern;
+		i += sizeof(size_t);
+	}
+	while (i < n)
+		d[i++] = (unsigned char)c;
+}
+
+//!/* Each word is loaded before the store that may overlap it, so this */
+//!/* is also a correct memmove when dst is below src */
+void	gc_mem_copy_words(void *dst, const void *src, size_t n)
+{
+	unsigned char		*d;
+	const unsigned char	*s;
+	size_t				i;
+
+	d = dst;
+	s = src;
+	i = 0;
+	while (i < n && ((uintptr_t)(d + i) & (sizeof(size_t) - 1)))
+	{
+		d[i] = s[i];
+		i++;
+	}
+	while (i + sizeof(size_t) <= n)
+	{
+		*(t_gc_word *)(d + i) = *(const t_gc_word *)(s + i);
+		i += sizeof(size_t);
+	}
+	while (i < n)
+	{
+		d[i] = s[i];
+		i++;
+	}
+}
+
+//!/* Mirror of gc_mem_copy_words for a dst above an overlapping src */
+void	gc_mem_copy_words_back(void *dst, const void *src, size_t n)
+{
+	unsigned char		*d;
+	const unsigned char	*s;
+
+	d = dst;
+	s = src;
+	while (n >= sizeof(size_t))
+	{
+		n -= sizeof(size_t);
+		*(t_gc_word *)(d + n) = *(const t_gc_word *)(s + n);
+	}
+	while (n > 0)
+	{
+		n--;
+		d[n] = s[n];
+	}
+}
+
+size_t	gc_mem_cmp_words(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	size_t				i;
+
+	a = s1;
+	b = s2;
+	i = 0;
+	while (i + sizeof(size_t) <= n
+		&& *(const t_gc_word *)(a + i) == *(const t_gc_word *)(b + i))
+		i += sizeof(size_t);
+	while (i < n && a[i] == b[i])
+		i++;
+	return (i);
+}
+
+//!/* (w - 0x01..) & ~w & 0x80.. is non-zero iff some byte of w is zero */
+size_t	gc_mem_chr_words(const void *s, int c, size_t n)
+{
+	const unsigned char	*str;
+	size_t				ones;
+	size_t				word;
+	size_t				i;
+
+	str = s;
+	ones = (size_t)-1 / 0xFF;
+	i = 0;
+	while (i + sizeof(size_t) <= n)
+	{
+		word = *(const t_gc_word *)(str + i) ^ (ones * (unsigned char)c);
+		if ((word - ones) & ~word & (ones << 7))
+			break ;
+		i += sizeof(size_t);
+	}
+	while (i < n && str[i] != (unsigned char)c)
+		i++;
+	return (i);
+}
@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_os.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:55:33 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 22:55:33 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <sys/mman.h>
+
+//!/* Over-maps by one page and trims both ends to get GC_PAGE_SIZE alignment */
+void	*gc_os_map(size_t size)
+{
+	char		*raw;
+	uintptr_t	aligned;
+	size_t		head;
+
+	raw = mmap(NULL, size + GC_PAGE_SIZE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (raw == MAP_FAILED)
+		return (NULL);
+	aligned = ((uintptr_t)raw + GC_PAGE_SIZE - 1)
+		& ~(uintptr_t)(GC_PAGE_SIZE - 1);
+	head = aligned - (uintptr_t)raw;
+	if (head > 0)
+		munmap(raw, head);
+	if (head < GC_PAGE_SIZE)
+		munmap((char *)aligned + size, GC_PAGE_SIZE - head);
+	return ((void *)aligned);
+}
+
+void	gc_os_unmap(void *ptr, size_t size)
+{
+	if (ptr)
+		munmap(ptr, size);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_owner.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:56:51 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:04:14 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Chunk of an open region whose objects so far span ptr, if any */
+static t_collecter	*open_region_chunk(void *ptr)
+{
+	t_gc_region	*region;
+	t_collecter	*chunk;
+
+	region = get_gc_heap()->regions;
+	while (region)
+	{
+		chunk = region->chunks;
+		while (chunk && (uintptr_t)ptr >= region->min
+			&& (uintptr_t)ptr < region->max)
+		{
+			if ((char *)ptr >= (char *)(chunk + 1)
+				&& (char *)ptr < (char *)(chunk + 1) + chunk->size)
+				return (chunk);
+			chunk = chunk->next;
+		}
+		region = region->next;
+	}
+	return (NULL);
+}
+
+//!/* What ptr is to the current instance, called with the lock held. Only */
+//!/* memory the instance owns is read, so a pointer from another instance */
+//!/* or none at all is GC_OWNER_NONE; so is one inside a large block. The */
+//!/* block set answers for large blocks, the slower lookups for the rest */
+int	gc_owner(void *ptr)
+{
+	t_collecter	*chunk;
+
+	if (gc_page_find(ptr))
+		return (GC_OWNER_PAGE);
+	if (gc_blocks_find(ptr))
+		return (GC_OWNER_LARGE);
+	chunk = gc_index_find(ptr);
+	if (chunk && (void *)(chunk + 1) == ptr)
+		return (GC_OWNER_LARGE);
+	if (!chunk)
+		chunk = open_region_chunk(ptr);
+	if (chunk && gc_region_object(ptr) && gc_region_chunk(ptr) == chunk)
+		return (GC_OWNER_REGION);
+	return (GC_OWNER_NONE);
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_page.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:55:33 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:50:58 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	append_page(t_gc_page *page, size_t size_class)
+{
+	t_gc_heap	*heap;
+
+	heap = get_gc_heap();
+	if (heap->last[page->flags][size_class])
+		heap->last[page->flags][size_class]->next = page;
+	else
+		heap->pages[page->flags][size_class] = page;
+	heap->last[page->flags][size_class] = page;
+	heap->current[page->flags][size_class] = page;
+	heap->page_count++;
+	page->sweep_epoch = heap->epoch;
+	gc_stats_heap_grew();
+}
+
+//!/* Pages made during a concurrent mark are not protected: its final */
+//!/* pause rescans them whole */
+static void	layout_page(t_gc_page *page, size_t words)
+{
+	page->words = words;
+	page->mark_bits = (unsigned long *)(page + 1);
+	page->alloc_bits = page->mark_bits + words;
+	page->cards = (unsigned char *)(page->alloc_bits + words);
+	if (get_gc_concurrent()->active)
+	{
+		page->dirty = 1;
+		gc_memset(page->cards, 1, GC_CARD_COUNT);
+	}
+}
+
+//!/* Descriptor, both bitmaps and the card table share one malloc'd block */
+t_gc_page	*gc_page_create(size_t size_class, unsigned char flags)
+{
+	t_gc_page	*page;
+	size_t		obj_size;
+	size_t		words;
+
+	obj_size = gc_class_size(size_class);
+	words = (GC_PAGE_SIZE / obj_size + GC_WORD_BITS - 1) / GC_WORD_BITS;
+	page = calloc(1, sizeof(t_gc_page) + 2 * words * sizeof(unsigned long)
+			+ GC_CARD_COUNT);
+	if (!page)
+		return (NULL);
+	page->base = gc_os_map(GC_PAGE_SIZE);
+	if (!page->base || !gc_page_map_set(page->base, GC_PAGE_SIZE, page))
+	{
+		gc_os_unmap(page->base, GC_PAGE_SIZE);
+		free(page);
+		return (NULL);
+	}
+	page->obj_size = obj_size;
+	page->obj_count = GC_PAGE_SIZE / obj_size;
+	page->flags = flags;
+	layout_page(page, words);
+	append_page(page, size_class);
+	return (page);
+}
+
+void	gc_page_destroy(t_gc_page *page)
+{
+	gc_page_map_set(page->base, GC_PAGE_SIZE, NULL);
+	gc_os_unmap(page->base, GC_PAGE_SIZE);
+	get_gc_heap()->page_count--;
+	free(page);
+}
+
+//!/* Resolves ptr to a slot index, honouring the interior-pointer rules */
+int	gc_page_slot(t_gc_page *page, void *ptr, size_t *slot)
+{
+	size_t	offset;
+	size_t	index;
+
+	offset = (size_t)((char *)ptr - page->base);
+	index = offset / page->obj_size;
+	if (index >= page->obj_count)
+		return (0);
+	if (!(page->alloc_bits[index / GC_WORD_BITS]
+			& (1UL << (index % GC_WORD_BITS))))
+		return (0);
+	if (offset % page->obj_size != 0 && !get_gc_config()->interior_pointers
+		&& !(page->flags & GC_FLAG_INTERIOR))
+		return (0);
+	*slot = index;
+	return (1);
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_page_map.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:55:33 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 22:55:33 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static t_gc_page	**map_slot(uintptr_t granule, int create)
+{
+	t_gc_heap	*heap;
+	size_t		top;
+
+	heap = get_gc_heap();
+	top = granule >> GC_MAP_BITS;
+	if (top >= ((size_t)1 << GC_MAP_BITS))
+		return (NULL);
+	if (!heap->map && create)
+		heap->map = calloc((size_t)1 << GC_MAP_BITS, sizeof(t_gc_page **));
+	if (!heap->map)
+		return (NULL);
+	if (!heap->map[top] && create)
+		heap->map[top] = calloc((size_t)1 << GC_MAP_BITS, sizeof(t_gc_page *));
+	if (!heap->map[top])
+		return (NULL);
+	return (&heap->map[top][granule & (((uintptr_t)1 << GC_MAP_BITS) - 1)]);
+}
+
+//!/* Maps every GC_PAGE_SIZE granule of [base, base + size) to page */
+int	gc_page_map_set(void *base, size_t size, t_gc_page *page)
+{
+	t_gc_heap	*heap;
+	t_gc_page	**slot;
+	uintptr_t	granule;
+
+	heap = get_gc_heap();
+	granule = (uintptr_t)base >> GC_PAGE_SHIFT;
+	while (granule <= ((uintptr_t)base + size - 1) >> GC_PAGE_SHIFT)
+	{
+		slot = map_slot(granule, page != NULL);
+		if (!slot && page)
+		{
+			gc_page_map_set(base, size, NULL);
+			return (0);
+		}
+		if (slot)
+			*slot = page;
+		granule++;
+	}
+	if (!page)
+		return (1);
+	if (heap->min == 0 || (uintptr_t)base < heap->min)
+		heap->min = (uintptr_t)base;
+	if ((uintptr_t)base + size > heap->max)
+		heap->max = (uintptr_t)base + size;
+	return (1);
+}
+
+t_gc_page	*gc_page_find(void *ptr)
+{
+	t_gc_heap	*heap;
+	t_gc_page	**slot;
+
+	heap = get_gc_heap();
+	if ((uintptr_t)ptr < heap->min || (uintptr_t)ptr >= heap->max)
+		return (NULL);
+	slot = map_slot((uintptr_t)ptr >> GC_PAGE_SHIFT, 0);
+	if (!slot)
+		return (NULL);
+	return (*slot);
+}
+
+void	gc_page_map_release(void)
+{
+	t_gc_heap	*heap;
+	size_t		top;
+
+	heap = get_gc_heap();
+	if (!heap->map)
+		return ;
+	top = 0;
+	while (top < ((size_t)1 << GC_MAP_BITS))
+	{
+		free(heap->map[top]);
+		top++;
+	}
+	free(heap->map);
+	heap->map = NULL;
+	heap->min = 0;
+	heap->max = 0;
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_policy.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:57:38 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:13:40 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+void	gc_set_policy(const t_gc_policy *policy)
+{
+	if (!policy)
+		return ;
+	gc_lock();
+	get_gc_config()->policy = *policy;
+	gc_unlock();
+}
+
+void	gc_get_policy(t_gc_policy *policy)
+{
+	if (policy)
+		*policy = get_gc_config()->policy;
+}
+
+void	gc_disable(void)
+{
+	gc_lock();
+	get_gc_config()->disable_count++;
+	gc_unlock();
+}
+
+void	gc_enable(void)
+{
+	gc_lock();
+	if (get_gc_config()->disable_count > 0)
+		get_gc_config()->disable_count--;
+	gc_unlock();
+}
+
+void	gc_set_mark_threads(size_t count)
+{
+	if (count == 0)
+		count = 1;
+	if (count > GC_MARKERS_MAX)
+		count = GC_MARKERS_MAX;
+	gc_lock();
+	get_gc_config()->mark_threads = count;
+	gc_unlock();
+}
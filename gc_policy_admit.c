@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_policy_admit.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:57:38 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:46:23 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static size_t	heap_size(t_gc_heap *heap)
+{
+	return (heap->live_bytes + heap->allocated_bytes);
+}
+
+//!/* The budget is growth_factor * survivors, but never below min_heap */
+//!/* In generational mode min_heap alone is the young generation's size */
+//!/* During a concurrent mark only what was allocated since it began counts */
+static int	budget_exhausted(t_gc_config *config, t_gc_heap *heap)
+{
+	t_gc_concurrent	*concurrent;
+	size_t			budget;
+	size_t			allocated;
+
+	budget = 0;
+	if (!config->generational)
+		budget = (size_t)(heap->live_bytes * config->policy.growth_factor);
+	if (budget < config->policy.min_heap)
+		budget = config->policy.min_heap;
+	allocated = heap->allocated_bytes;
+	concurrent = get_gc_concurrent();
+	if (concurrent->active && allocated >= concurrent->allocated)
+		allocated -= concurrent->allocated;
+	return (allocated >= budget);
+}
+
+static int	exceeds_max_heap(t_gc_policy *policy, t_gc_heap *heap,
+		size_t size)
+{
+	if (policy->max_heap == 0)
+		return (0);
+	return (size > policy->max_heap
+		|| heap_size(heap) > policy->max_heap - size);
+}
+
+//!/* Collects when the budget is spent; returns 0 if max_heap forbids size */
+//!/* A concurrent collection only blocks when the heap limit is in the way; */
+//!/* one whose background drain is over gets its final pause here, and an */
+//!/* incremental one the steps fell behind on is finished */
+int	gc_policy_admit(size_t size)
+{
+	t_gc_config	*config;
+	t_gc_heap	*heap;
+	int			over;
+
+	config = get_gc_config();
+	heap = get_gc_heap();
+	if (gc_concurrent_drained())
+		gc_concurrent_finish();
+	over = exceeds_max_heap(&config->policy, heap, size);
+	if (config->disable_count == 0 && *get_gc_stack_start()
+		&& (budget_exhausted(config, heap) || over))
+		gc_concurrent_collect(over);
+	return (!exceeds_max_heap(&config->policy, heap, size));
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_preclean.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:09:24 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:46:23 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <sys/mman.h>
+
+//!/* Pointer-free pages are never protected: the fault handler skips them */
+static int	reprotect_page(t_gc_page *page)
+{
+	if (!get_gc_concurrent()->protecting || (page->flags & GC_FLAG_ATOMIC))
+		return (1);
+	return (mprotect(page->base, GC_PAGE_SIZE, PROT_READ) == 0);
+}
+
+//!/* The cards are taken before the page is protected again and scanned */
+//!/* after, so a store racing with the scan faults and dirties it anew */
+static void	clean_page(t_gc_page *page)
+{
+	unsigned char	cards[GC_CARD_COUNT];
+	size_t			card;
+
+	page->dirty = 0;
+	card = 0;
+	while (card < GC_CARD_COUNT)
+	{
+		cards[card] = __atomic_exchange_n(&page->cards[card], 0,
+				__ATOMIC_ACQ_REL);
+		card++;
+	}
+	if (!reprotect_page(page))
+	{
+		page->dirty = 1;
+		gc_memset(page->cards, 1, GC_CARD_COUNT);
+	}
+	card = 0;
+	while (card < GC_CARD_COUNT)
+	{
+		if (cards[card])
+			gc_scan_card(page, card);
+		card++;
+	}
+}
+
+//!/* Blocks mapped during the mark are missing from the index the fault */
+//!/* handler searches: they can't be protected again and stay dirty. The */
+//!/* others go back on the mark stack, to be scanned in bounded chunks: */
+//!/* only their written kernel pages when they have cards */
+static void	clean_block(t_collecter *node)
+{
+	size_t	prefix;
+	int		protecting;
+
+	prefix = gc_protect_prefix(node);
+	protecting = get_gc_concurrent()->protecting;
+	if (protecting && (prefix == 0 || gc_index_find(node + 1) != node))
+		return ;
+	node->dirty = 0;
+	if (gc_large_cards_push(node, 1))
+		return ;
+	if (protecting && mprotect((char *)(node + 1) + prefix,
+			node->mapped - sizeof(t_collecter) - prefix, PROT_READ) != 0)
+		node->dirty = 1;
+	gc_mark_stack_push((void *)(node + 1), node->size, node->flags);
+}
+
+static void	clean_blocks(void)
+{
+	t_collecter	*node;
+
+	node = *get_gc_head();
+	while (node)
+	{
+		if (node->dirty && node->is_marked)
+			clean_block(node);
+		node = node->next;
+	}
+}
+
+//!/* Called with the lock held during an incremental mark: rescans what */
+//!/* was written so far, so that ending the mark only rescans what is */
+//!/* written after. Returns 1 once done, 0 if the deadline came first */
+int	gc_preclean(unsigned long long deadline)
+{
+	t_gc_heap	*heap;
+	t_gc_page	*page;
+	size_t		list;
+
+	heap = get_gc_heap();
+	list = 0;
+	while (list < GC_KIND_COUNT * GC_CLASS_COUNT)
+	{
+		page = heap->pages[list / GC_CLASS_COUNT][list % GC_CLASS_COUNT];
+		while (page)
+		{
+			if (page->dirty)
+			{
+				clean_page(page);
+				if (gc_now_ns() >= deadline)
+					return (0);
+			}
+			page = page->next;
+		}
+		list++;
+	}
+	clean_blocks();
+	return (1);
+}
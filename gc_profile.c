@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_profile.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:27:30 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:27:30 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <execinfo.h>
+
+//!/* xorshift64*, seeded from the thread's sampler and the clock */
+static unsigned long	next_random(t_gc_sampler *sampler)
+{
+	if (!sampler->seed)
+		sampler->seed = ((uintptr_t)sampler ^ gc_now_ns()) | 1;
+	sampler->seed ^= sampler->seed >> 12;
+	sampler->seed ^= sampler->seed << 25;
+	sampler->seed ^= sampler->seed >> 27;
+	return (sampler->seed * 0x2545f4914f6cdd1dUL);
+}
+
+//!/* Exponential with mean period, so that samples form a Poisson process */
+//!/* over the bytes allocated: -ln(u) = -log2(u) * ln 2, with log2 of the */
+//!/* 26-bit u taken from its leading zeros and a linear mantissa */
+static size_t	next_interval(t_gc_sampler *sampler, size_t period)
+{
+	unsigned long	u;
+	int				exponent;
+	double			log2_u;
+
+	u = (next_random(sampler) >> 38) + 1;
+	exponent = 63 - __builtin_clzl(u);
+	log2_u = exponent + (double)(u - (1UL << exponent))
+		/ (double)(1UL << exponent);
+	return ((size_t)((26.0 - log2_u) * 0.6931471805599453 * period) + 1);
+}
+
+//!/* One load and a branch per allocation while profiling is off. The */
+//!/* allocation that uses up the countdown is sampled, unless it is the */
+//!/* thread's first since the interval changed; region objects never are */
+void	*gc_profile_note(void *ptr, size_t size)
+{
+	t_gc_sampler	*sampler;
+	size_t			period;
+
+	period = __atomic_load_n(get_gc_profile_period(), __ATOMIC_RELAXED);
+	if (!period || !ptr)
+		return (ptr);
+	sampler = get_gc_sampler();
+	if (sampler->period == period && sampler->left > size)
+	{
+		sampler->left -= size;
+		return (ptr);
+	}
+	if (sampler->period == period
+		&& (gc_page_find(ptr) || !gc_region_object(ptr)))
+		gc_profile_sample(ptr, size);
+	sampler->period = period;
+	sampler->left = next_interval(sampler, period);
+	return (ptr);
+}
+
+//!/* backtrace loads its unwinder on first use, which may call malloc: */
+//!/* that happens here rather than in the middle of an allocation */
+void	gc_set_profiling(size_t sample_bytes)
+{
+	void	*frame;
+
+	if (sample_bytes)
+		backtrace(&frame, 1);
+	__atomic_store_n(get_gc_profile_period(), sample_bytes, __ATOMIC_RELAXED);
+}
+
+//!/* Called with the lock held by gc_instance_release; both tables share */
+//!/* the block of @samples */
+void	gc_profile_release(void)
+{
+	t_gc_profile	*profile;
+	t_gc_sample		*sample;
+	t_gc_site		*site;
+	size_t			i;
+
+	profile = get_gc_profile();
+	i = 0;
+	while (profile->samples && i < GC_PROFILE_BUCKETS)
+	{
+		while (profile->samples[i])
+		{
+			sample = profile->samples[i];
+			profile->samples[i] = sample->next;
+			free(sample);
+		}
+		while (profile->sites[i])
+		{
+			site = profile->sites[i];
+			profile->sites[i] = site->next;
+			free(site);
+		}
+		i++;
+	}
+	free(profile->samples);
+	gc_memset(profile, 0, sizeof(t_gc_profile));
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_profile_collect.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:27:30 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:36:24 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	clear_sites(t_gc_site *site)
+{
+	while (site)
+	{
+		site->live_samples = 0;
+		site->live_bytes = 0;
+		site = site->next;
+	}
+}
+
+//!/* Survivors count towards their site, the others are forgotten. */
+//!/* Samples die with their objects, so a large one's header is still */
+//!/* mapped here */
+static void	prune_chain(t_gc_profile *profile, t_gc_sample **link)
+{
+	t_gc_sample	*sample;
+
+	while (*link)
+	{
+		sample = *link;
+		if (gc_is_marked(sample->ptr))
+		{
+			sample->site->live_samples++;
+			sample->site->live_bytes += sample->size;
+			link = &sample->next;
+			continue ;
+		}
+		*link = sample->next;
+		free(sample);
+		profile->count--;
+	}
+}
+
+//!/* Called with the lock held between a mark and its sweep, which may */
+//!/* free the objects of dead samples; a pending gc_dump_heap writes then */
+void	gc_profile_collect(void)
+{
+	t_gc_profile	*profile;
+	size_t			i;
+
+	profile = get_gc_profile();
+	i = 0;
+	while (profile->samples && i < GC_PROFILE_BUCKETS)
+		clear_sites(profile->sites[i++]);
+	i = 0;
+	while (profile->samples && i < GC_PROFILE_BUCKETS)
+		prune_chain(profile, &profile->samples[i++]);
+	if (profile->dump)
+		gc_dump_objects();
+}
+
+//!/* Called by gc_compact once the objects moved, before their old pages */
+//!/* go. Samples rehashed into a later chain are forwarded again there, */
+//!/* which leaves them where they are */
+void	gc_profile_forward(void)
+{
+	t_gc_profile	*profile;
+	t_gc_sample		*chain;
+	t_gc_sample		*sample;
+	t_gc_sample		**link;
+	size_t			i;
+
+	profile = get_gc_profile();
+	i = 0;
+	while (profile->samples && i < GC_PROFILE_BUCKETS)
+	{
+		chain = profile->samples[i];
+		profile->samples[i] = NULL;
+		while (chain)
+		{
+			sample = chain;
+			chain = sample->next;
+			sample->ptr = gc_compact_forward(sample->ptr);
+			link = &profile->samples[gc_profile_bucket(sample->ptr)];
+			sample->next = *link;
+			*link = sample;
+		}
+		i++;
+	}
+}
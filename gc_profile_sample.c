@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_profile_sample.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:27:30 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:27:30 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <execinfo.h>
+
+//!/* Fibonacci hashing of the address, small objects being 16-aligned */
+size_t	gc_profile_bucket(void *ptr)
+{
+	return (((((uintptr_t)ptr >> 4) * 0x9e3779b97f4a7c15UL) >> 32)
+		% GC_PROFILE_BUCKETS);
+}
+
+//!/* Link holding the sample of ptr, or the empty link ending its chain; */
+//!/* NULL before the first sample */
+t_gc_sample	**gc_profile_find(void *ptr)
+{
+	t_gc_profile	*profile;
+	t_gc_sample		**link;
+
+	profile = get_gc_profile();
+	if (!profile->samples)
+		return (NULL);
+	link = &profile->samples[gc_profile_bucket(ptr)];
+	while (*link && (*link)->ptr != ptr)
+		link = &(*link)->next;
+	return (link);
+}
+
+//!/* The backtrace is taken without the lock; the frames of the sampler */
+//!/* itself are dropped, the allocation function comes first */
+void	gc_profile_sample(void *ptr, size_t size)
+{
+	void	*frames[GC_PROFILE_DEPTH + GC_PROFILE_SKIP];
+	int		depth;
+
+	depth = backtrace(frames, GC_PROFILE_DEPTH + GC_PROFILE_SKIP);
+	if (depth <= GC_PROFILE_SKIP)
+		return ;
+	gc_lock();
+	gc_profile_record(ptr, size, frames + GC_PROFILE_SKIP,
+		depth - GC_PROFILE_SKIP);
+	gc_unlock();
+}
+
+//!/* Called with the lock held when gc_free releases ptr */
+void	gc_profile_forget(void *ptr)
+{
+	t_gc_sample	**link;
+	t_gc_sample	*sample;
+
+	link = gc_profile_find(ptr);
+	if (!link || !*link)
+		return ;
+	sample = *link;
+	*link = sample->next;
+	free(sample);
+	get_gc_profile()->count--;
+}
+
+//!/* Called with the lock held when mremap moved a block */
+void	gc_profile_move(void *old, void *moved)
+{
+	t_gc_sample	**link;
+	t_gc_sample	*sample;
+
+	link = gc_profile_find(old);
+	if (!link || !*link)
+		return ;
+	sample = *link;
+	*link = sample->next;
+	sample->ptr = moved;
+	link = &get_gc_profile()->samples[gc_profile_bucket(moved)];
+	sample->next = *link;
+	*link = sample;
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_profile_site.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:27:30 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:27:30 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* FNV-1a over the return addresses */
+static size_t	hash_frames(void **frames, size_t depth)
+{
+	size_t	hash;
+	size_t	i;
+
+	hash = 14695981039346656037UL;
+	i = 0;
+	while (i < depth)
+	{
+		hash = (hash ^ (uintptr_t)frames[i]) * 1099511628211UL;
+		i++;
+	}
+	return (hash);
+}
+
+//!/* Called with the lock held; NULL only when malloc fails */
+static t_gc_site	*find_site(void **frames, size_t depth)
+{
+	t_gc_profile	*profile;
+	t_gc_site		**link;
+	t_gc_site		*site;
+	size_t			hash;
+
+	profile = get_gc_profile();
+	hash = hash_frames(frames, depth);
+	link = &profile->sites[hash % GC_PROFILE_BUCKETS];
+	site = *link;
+	while (site && (site->hash != hash || site->depth != depth
+			|| gc_memcmp(site->frames, frames, depth * sizeof(void *))))
+		site = site->next;
+	if (site)
+		return (site);
+	site = calloc(1, sizeof(t_gc_site));
+	if (!site)
+		return (NULL);
+	profile->site_count++;
+	site->id = profile->site_count;
+	site->hash = hash;
+	site->depth = depth;
+	gc_memcpy(site->frames, frames, depth * sizeof(void *));
+	site->next = *link;
+	*link = site;
+	return (site);
+}
+
+//!/* Both hash tables come from one block, made by the first sample */
+static int	reserve(t_gc_profile *profile)
+{
+	if (profile->samples)
+		return (1);
+	profile->samples = calloc(2 * GC_PROFILE_BUCKETS, sizeof(void *));
+	if (!profile->samples)
+		return (0);
+	profile->sites = (t_gc_site **)(profile->samples + GC_PROFILE_BUCKETS);
+	return (1);
+}
+
+//!/* Called with the lock held; a sample already at ptr is replaced, as */
+//!/* when gc_realloc resizes a block in place */
+void	gc_profile_record(void *ptr, size_t size, void **frames, size_t depth)
+{
+	t_gc_profile	*profile;
+	t_gc_sample		**link;
+	t_gc_site		*site;
+
+	profile = get_gc_profile();
+	if (!reserve(profile))
+		return ;
+	site = find_site(frames, depth);
+	link = gc_profile_find(ptr);
+	if (!site)
+		return ;
+	if (!*link)
+		*link = calloc(1, sizeof(t_gc_sample));
+	if (!*link)
+		return ;
+	if (!(*link)->ptr)
+		profile->count++;
+	(*link)->ptr = ptr;
+	(*link)->size = size;
+	(*link)->site = site;
+	site->samples++;
+	site->sampled_bytes += size;
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_protect.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:50:57 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:46:23 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+//!/* Data bytes in front of the protected part of a mapped block, 0 when */
+//!/* the block is not protected. Typed blocks keep their layout at the end */
+//!/* and pointer-free blocks need no tracking: both stay writable */
+size_t	gc_protect_prefix(t_collecter *node)
+{
+	size_t	os_page;
+
+	os_page = (size_t)sysconf(_SC_PAGESIZE);
+	if (!node->mapped || node->mapped <= os_page || !get_gc_index()->valid
+		|| (node->flags & (GC_FLAG_TYPED | GC_FLAG_ATOMIC)))
+		return (0);
+	return (os_page - sizeof(t_collecter));
+}
+
+//!/* Pages that could not be protected are rescanned whole instead */
+static void	flush_run(uintptr_t start, uintptr_t end, int prot)
+{
+	t_gc_page	*page;
+
+	if (start == end || mprotect((void *)start, end - start, prot) == 0
+		|| prot != PROT_READ)
+		return ;
+	while (start < end)
+	{
+		page = gc_page_find((void *)start);
+		page->dirty = 1;
+		gc_memset(page->cards, 1, GC_CARD_COUNT);
+		start += GC_PAGE_SIZE;
+	}
+}
+
+//!/* Walks the heap in address order so neighbouring pages share one */
+//!/* mprotect call; pointer-free pages are never protected */
+static void	protect_pages(int prot)
+{
+	t_gc_heap	*heap;
+	t_gc_page	*page;
+	uintptr_t	addr;
+	uintptr_t	run;
+
+	heap = get_gc_heap();
+	addr = heap->min;
+	run = addr;
+	while (addr < heap->max)
+	{
+		page = gc_page_find((void *)addr);
+		if (!page || (page->flags & GC_FLAG_ATOMIC))
+		{
+			flush_run(run, addr, prot);
+			run = addr + GC_PAGE_SIZE;
+		}
+		addr += GC_PAGE_SIZE;
+	}
+	flush_run(run, addr, prot);
+}
+
+//!/* The first kernel page holds the header the markers write to */
+static void	protect_blocks(int prot)
+{
+	t_gc_index	*index;
+	t_collecter	*node;
+	size_t		prefix;
+	size_t		i;
+
+	index = get_gc_index();
+	i = 0;
+	while (index->valid && i < index->count)
+	{
+		node = index->blocks[i];
+		prefix = gc_protect_prefix(node);
+		if (prefix > 0 && mprotect((char *)(node + 1) + prefix,
+				node->mapped - sizeof(t_collecter) - prefix, prot) != 0
+			&& prot == PROT_READ)
+			gc_large_dirty(node, NULL);
+		i++;
+	}
+}
+
+//!/* Runs with the world stopped, at both ends of a concurrent mark and */
+//!/* after an incremental step fails to end one; no-op in barrier mode */
+void	gc_protect_heap(int enable)
+{
+	int	prot;
+
+	if (!get_gc_concurrent()->protecting)
+		return ;
+	prot = PROT_READ | PROT_WRITE;
+	if (enable)
+		prot = PROT_READ;
+	protect_pages(prot);
+	protect_blocks(prot);
+}
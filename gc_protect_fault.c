@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_protect_fault.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:50:57 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+//!/* Same search as gc_index_find, but over whole mappings */
+static t_collecter	*find_mapped(uintptr_t addr)
+{
+	t_gc_index	*index;
+	size_t		low;
+	size_t		high;
+	size_t		mid;
+	t_collecter	*node;
+
+	index = get_gc_index();
+	if (!index->valid)
+		return (NULL);
+	low = 0;
+	high = index->count;
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+		if ((uintptr_t)index->blocks[mid] <= addr)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	if (low == 0)
+		return (NULL);
+	node = index->blocks[low - 1];
+	if (!gc_protect_prefix(node) || addr >= (uintptr_t)node + node->mapped)
+		return (NULL);
+	return (node);
+}
+
+//!/* The page, or the kernel page of a block, becomes writable and is */
+//!/* rescanned by the final pause; pointer-free pages are never */
+//!/* protected, so a fault on one is not ours */
+static int	claim_fault(void *addr)
+{
+	t_gc_page	*page;
+	t_collecter	*node;
+	size_t		os_page;
+
+	page = gc_page_find(addr);
+	if (page && !(page->flags & GC_FLAG_ATOMIC))
+	{
+		page->dirty = 1;
+		gc_memset(page->cards, 1, GC_CARD_COUNT);
+		return (mprotect(page->base, GC_PAGE_SIZE,
+				PROT_READ | PROT_WRITE) == 0);
+	}
+	if (page)
+		return (0);
+	node = find_mapped((uintptr_t)addr);
+	if (!node)
+		return (0);
+	gc_large_dirty(node, addr);
+	if (!node->cards)
+		return (mprotect(node, node->mapped, PROT_READ | PROT_WRITE) == 0);
+	os_page = (size_t)sysconf(_SC_PAGESIZE);
+	return (mprotect((void *)((uintptr_t)addr & ~(os_page - 1)), os_page,
+			PROT_READ | PROT_WRITE) == 0);
+}
+
+//!/* The fault may hit any instance: each is made current in turn */
+int	gc_protect_claim(void *addr)
+{
+	t_gc_instance	*previous;
+	t_gc_instance	*instance;
+	int				claimed;
+
+	previous = gc_instance_switch(NULL);
+	claimed = claim_fault(addr);
+	instance = __atomic_load_n(get_gc_instances(), __ATOMIC_ACQUIRE);
+	while (!claimed && instance)
+	{
+		gc_instance_switch(instance);
+		claimed = claim_fault(addr);
+		instance = instance->next;
+	}
+	gc_instance_switch(previous);
+	return (claimed);
+}
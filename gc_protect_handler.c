@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_protect_fault.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:50:57 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "internal_collector.h"
+#include <errno.h>
+
+//!/* Without a handler to pass it to, the default action is restored and */
+//!/* the faulting instruction runs again */
+static void	forward_fault(int sig, siginfo_t *info, void *context)
+{
+	struct sigaction	*old;
+
+	old = &get_gc_world()->old_fault;
+	if ((old->sa_flags & SA_SIGINFO) && old->sa_sigaction)
+		old->sa_sigaction(sig, info, context);
+	else if (!(old->sa_flags & SA_SIGINFO) && old->sa_handler != SIG_DFL
+		&& old->sa_handler != SIG_IGN)
+		old->sa_handler(sig);
+	else
+		signal(sig, SIG_DFL);
+}
+
+static void	fault_handler(int sig, siginfo_t *info, void *context)
+{
+	int	saved_errno;
+
+	saved_errno = errno;
+	if (!gc_protect_claim(info->si_addr))
+		forward_fault(sig, info, context);
+	errno = saved_errno;
+}
+
+//!/* Called with the lock held. The suspend signal is blocked while a */
+//!/* fault is handled, so no pause can start halfway through one */
+int	gc_protect_install(void)
+{
+	t_gc_world			*world;
+	struct sigaction	action;
+
+	world = get_gc_world();
+	if (world->fault_installed)
+		return (1);
+	gc_memset(&action, 0, sizeof(action));
+	action.sa_sigaction = fault_handler;
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	sigaddset(&action.sa_mask, GC_SIG_SUSPEND);
+	if (sigaction(GC_SIG_FAULT, &action, &world->old_fault) != 0)
+		return (0);
+	world->fault_installed = 1;
+	return (1);
+}
+
+//!/* Called with the lock held by collector_close */
+void	gc_protect_uninstall(void)
+{
+	t_gc_world	*world;
+
+	world = get_gc_world();
+	if (world->fault_installed)
+		sigaction(GC_SIG_FAULT, &world->old_fault, NULL);
+	world->fault_installed = 0;
+}
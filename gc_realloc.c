@@ -6,30 +6,91 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 16:57:17 by akivam            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 02:09:01 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "internal_collector.h"
 
+//!/* Small objects report their size class, large ones their header size */
+//!/* and region objects the size they were asked with */
+size_t	gc_block_size(void *ptr, unsigned char *flags)
+{
+	t_gc_page	*page;
+	t_collecter	*header;
+
+	page = gc_page_find(ptr);
+	if (page)
+	{
+		*flags = page->flags;
+		return (page->obj_size);
+	}
+	if (gc_region_object(ptr))
+		return (gc_region_size(ptr, flags));
+	header = get_header_from_ptr(ptr);
+	*flags = header->flags;
+	return (header->size);
+}
+
+//!/* Allocates with the kind of ptr; typed blocks also copy the layout. */
+//!/* Growth leaves a reserve in malloc'd large blocks */
+static void	*alloc_like(void *ptr, size_t size, size_t *old_size)
+{
+	unsigned char	flags;
+
+	*old_size = gc_block_size(ptr, &flags);
+	if (!(flags & GC_FLAG_TYPED) && size > *old_size)
+		return (gc_profile_note(gc_large_reserve(size, flags), size));
+	if (!(flags & GC_FLAG_TYPED))
+		return (gc_profile_note(gc_alloc(size, flags), size));
+	*old_size -= sizeof(t_gc_layout);
+	return (gc_malloc_typed(size, (t_gc_layout *)((char *)ptr + *old_size)));
+}
+
+//!/* Small blocks stay in their slot while the size class is unchanged, */
+//!/* malloc'd large ones while their capacity suits the new size */
+static int	resize_in_place(void *ptr, size_t size)
+{
+	t_gc_page	*page;
+
+	page = gc_page_find(ptr);
+	if (page)
+	{
+		if (size > GC_SMALL_MAX)
+			return (0);
+		if (page->flags & GC_FLAG_TYPED)
+			size += sizeof(t_gc_layout);
+		return (size <= GC_SMALL_MAX
+			&& gc_class_size(gc_size_class(size)) == page->obj_size);
+	}
+	return (gc_large_resize(ptr, size));
+}
+
+//!/* Mapped large blocks are resized by the kernel; others stay in place */
+//!/* when they can, and are copied otherwise, as region objects always are */
 void	*gc_realloc(void *ptr, size_t size)
 {
-	void		*new_ptr;
-	t_collecter	*old_header;
-	size_t		copy_size;
+	void			*new_ptr;
+	size_t			old_size;
+	size_t			copy_size;
 
 	if (!ptr)
 		return (gc_malloc(size));
 	if (size == 0)
 		return (NULL);
-	old_header = get_header_from_ptr(ptr);
-	if (!old_header)
-		return (NULL);
-	new_ptr = gc_malloc(size);
+	if (gc_page_find(ptr) || !gc_region_object(ptr))
+	{
+		new_ptr = gc_large_remap(ptr, size);
+		if (new_ptr)
+			return (gc_profile_note(new_ptr, size));
+		if (resize_in_place(ptr, size))
+			return (gc_profile_note(ptr, size));
+	}
+	new_ptr = alloc_like(ptr, size, &old_size);
 	if (!new_ptr)
 		return (NULL);
-	if (old_header->size < size)
-		copy_size = old_header->size;
+	if (old_size < size)
+		copy_size = old_size;
 	else
 		copy_size = size;
 	gc_memcpy(new_ptr, ptr, copy_size);
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_region.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:04:29 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:04:29 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static void	unlink_region(t_gc_region *region)
+{
+	t_gc_region	**link;
+
+	link = &get_gc_heap()->regions;
+	while (*link && *link != region)
+		link = &(*link)->next;
+	if (*link)
+		*link = region->next;
+}
+
+//!/* Chunks reached from outside are kept, and so is what they reach; */
+//!/* dirty tells the chunks already scanned */
+static void	spread(t_gc_region *region)
+{
+	t_collecter	*chunk;
+	int			found;
+
+	found = 1;
+	while (found)
+	{
+		found = 0;
+		chunk = region->chunks;
+		while (chunk)
+		{
+			if (chunk->is_marked && !chunk->dirty)
+			{
+				chunk->dirty = 1;
+				gc_region_find_refs(region, chunk + 1, chunk->size);
+				found = 1;
+			}
+			chunk = chunk->next;
+		}
+	}
+}
+
+//!/* Kept chunks join the block list whole: conservative references to */
+//!/* their objects can't be moved. The others go back to the kernel */
+static void	settle(t_gc_region *region)
+{
+	t_collecter	*chunk;
+	t_collecter	*next;
+
+	chunk = region->chunks;
+	while (chunk)
+	{
+		next = chunk->next;
+		if (chunk->is_marked)
+		{
+			gc_large_link(chunk, chunk->size, GC_FLAG_INTERIOR);
+			get_gc_heap()->allocated_bytes += gc_large_footprint(chunk);
+			get_gc_stats_state()->promoted_chunks++;
+		}
+		else
+			gc_region_unmap(chunk);
+		chunk = next;
+	}
+}
+
+int	gc_region_begin(void)
+{
+	t_gc_region	*region;
+
+	region = calloc(1, sizeof(t_gc_region));
+	if (!region)
+		return (0);
+	region->instance = *get_gc_current();
+	region->outer = *get_gc_region_self();
+	gc_lock();
+	region->next = get_gc_heap()->regions;
+	get_gc_heap()->regions = region;
+	gc_unlock();
+	*get_gc_region_self() = region;
+	return (1);
+}
+
+//!/* The escape scan runs with the world stopped, so that no thread moves */
+//!/* a reference out of sight while it looks */
+void	gc_region_end(void)
+{
+	t_gc_region		*region;
+	t_gc_instance	*previous;
+
+	region = *get_gc_region_self();
+	if (!region)
+		return ;
+	*get_gc_region_self() = region->outer;
+	previous = gc_instance_switch(region->instance);
+	gc_lock();
+	unlink_region(region);
+	if (region->chunks)
+	{
+		gc_roots_refresh();
+		gc_stop_world();
+		gc_region_find_escapes(region);
+		spread(region);
+		gc_start_world();
+		settle(region);
+	}
+	gc_unlock();
+	gc_instance_switch(previous);
+	free(region);
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_region_alloc.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:04:29 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:04:44 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* A chunk with room for need bytes. New ones are linked under the lock: */
+//!/* collections walk the chunks and compare against the bounds */
+static t_collecter	*chunk_for(t_gc_region *region, size_t need)
+{
+	t_collecter	*chunk;
+
+	chunk = region->chunks;
+	if (chunk && chunk->size + need <= chunk->mapped - sizeof(t_collecter))
+		return (chunk);
+	gc_lock();
+	chunk = gc_large_map(GC_REGION_CHUNK - sizeof(t_collecter));
+	if (chunk)
+		chunk->next = region->chunks;
+	if (chunk)
+		region->chunks = chunk;
+	gc_unlock();
+	if (!chunk)
+		return (NULL);
+	if (!region->min || (uintptr_t)chunk < region->min)
+		region->min = (uintptr_t)chunk;
+	if ((uintptr_t)chunk + chunk->mapped > region->max)
+		region->max = (uintptr_t)chunk + chunk->mapped;
+	return (chunk);
+}
+
+//!/* Bumps the newest chunk, without the lock. NULL leaves the object to */
+//!/* the heap: the region belongs to another instance, the object is */
+//!/* typed or above GC_REGION_MAX, or no chunk could be mapped */
+void	*gc_region_alloc(size_t size, unsigned char flags)
+{
+	t_gc_region	*region;
+	t_collecter	*chunk;
+	uintptr_t	*at;
+	size_t		need;
+
+	region = *get_gc_region_self();
+	if (region->instance != *get_gc_current() || size > GC_REGION_MAX
+		|| (flags & GC_FLAG_TYPED))
+		return (NULL);
+	need = (size + 2 * sizeof(uintptr_t) + 15) & ~(size_t)15;
+	chunk = chunk_for(region, need);
+	if (!chunk)
+		return (NULL);
+	at = (uintptr_t *)((char *)(chunk + 1) + chunk->size);
+	at[0] = ((uintptr_t)((char *)at - (char *)chunk) << 32)
+		| (size << 8) | flags;
+	at[1] = GC_REGION_TAG;
+	chunk->size += need;
+	*get_gc_fresh() = 1;
+	return (at + 2);
+}
+
+//!/* A block header keeps a pointer where region objects keep the tag */
+int	gc_region_object(void *ptr)
+{
+	return (((uintptr_t *)ptr)[-1] == GC_REGION_TAG);
+}
+
+t_collecter	*gc_region_chunk(void *ptr)
+{
+	uintptr_t	*at;
+
+	at = (uintptr_t *)ptr - 2;
+	return ((t_collecter *)((char *)at - (at[0] >> 32)));
+}
+
+size_t	gc_region_size(void *ptr, unsigned char *flags)
+{
+	uintptr_t	word;
+
+	word = ((uintptr_t *)ptr)[-2];
+	*flags = (unsigned char)word;
+	return ((word >> 8) & 0xffffff);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_region_heap.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:04:29 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:04:29 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Region gc_region_scan_heap looks for, read by the page callback */
+static t_gc_region	**get_target(void)
+{
+	static t_gc_region	*target;
+
+	return (&target);
+}
+
+//!/* Every allocated slot counts, swept or not: a dead object that still */
+//!/* points into the region only costs the chunk a trip to the heap */
+static void	scan_page(t_gc_page *page)
+{
+	size_t	slot;
+
+	if (page->flags & GC_FLAG_ATOMIC)
+		return ;
+	slot = 0;
+	while (slot < page->obj_count)
+	{
+		if (page->alloc_bits[slot / GC_WORD_BITS]
+			& (1UL << (slot % GC_WORD_BITS)))
+			gc_region_find_refs(*get_target(),
+				page->base + slot * page->obj_size, page->obj_size);
+		slot++;
+	}
+}
+
+static void	scan_regions(t_gc_region *region)
+{
+	t_gc_region	*other;
+	t_collecter	*chunk;
+
+	other = get_gc_heap()->regions;
+	while (other)
+	{
+		chunk = other->chunks;
+		while (chunk)
+		{
+			gc_region_find_refs(region, chunk + 1, chunk->size);
+			chunk = chunk->next;
+		}
+		other = other->next;
+	}
+}
+
+//!/* Called with the lock held and region off the open list */
+void	gc_region_scan_heap(t_gc_region *region)
+{
+	t_collecter	*node;
+
+	*get_target() = region;
+	gc_heap_for_each_page(scan_page);
+	node = *get_gc_head();
+	while (node)
+	{
+		if (!(node->flags & GC_FLAG_ATOMIC))
+			gc_region_find_refs(region, node + 1, node->size);
+		node = node->next;
+	}
+	scan_regions(region);
+}
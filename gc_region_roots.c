@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_region_roots.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:04:29 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:04:29 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Open regions hold objects the heap doesn't know about */
+void	gc_region_scan_roots(void)
+{
+	t_gc_region	*region;
+	t_collecter	*chunk;
+
+	region = get_gc_heap()->regions;
+	while (region)
+	{
+		chunk = region->chunks;
+		while (chunk)
+		{
+			mark_memory_region(chunk + 1, chunk->size);
+			chunk = chunk->next;
+		}
+		region = region->next;
+	}
+}
+
+//!/* Chunks were never counted in large_bytes, so gc_large_free won't do */
+void	gc_region_unmap(t_collecter *chunk)
+{
+	get_gc_stats_state()->region_chunks++;
+	free(chunk->cards);
+	gc_os_unmap(chunk, chunk->mapped);
+}
+
+//!/* Called with the lock held; regions still open are dropped with the */
+//!/* instance, the threads that opened them must not end them */
+void	gc_region_release(void)
+{
+	t_gc_region	*region;
+	t_gc_region	*next;
+	t_collecter	*chunk;
+	t_collecter	*next_chunk;
+
+	region = get_gc_heap()->regions;
+	while (region)
+	{
+		next = region->next;
+		chunk = region->chunks;
+		while (chunk)
+		{
+			next_chunk = chunk->next;
+			gc_region_unmap(chunk);
+			chunk = next_chunk;
+		}
+		free(region);
+		region = next;
+	}
+	get_gc_heap()->regions = NULL;
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_region_scan.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:04:29 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:04:29 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Marks each chunk of region that a word of the range points into */
+void	gc_region_find_refs(t_gc_region *region, void *start, size_t size)
+{
+	uintptr_t	*word;
+	uintptr_t	*end;
+	t_collecter	*chunk;
+
+	word = (uintptr_t *)((uintptr_t)start & ~(uintptr_t)(sizeof(void *) - 1));
+	end = (uintptr_t *)((char *)start + size);
+	while (word < end)
+	{
+		if (*word >= region->min && *word < region->max)
+		{
+			chunk = region->chunks;
+			while (chunk && (*word < (uintptr_t)(chunk + 1)
+					|| *word >= (uintptr_t)(chunk + 1) + chunk->size))
+				chunk = chunk->next;
+			if (chunk)
+				chunk->is_marked = 1;
+		}
+		word++;
+	}
+}
+
+static void	scan_between(t_gc_region *region, void *top, void *base)
+{
+	if (top > base)
+		gc_region_find_refs(region, base, (char *)top - (char *)base);
+	else
+		gc_region_find_refs(region, top, (char *)base - (char *)top);
+}
+
+//!/* Walks the stacks like mark_from_stack, registers spilled the same way */
+static void	scan_stacks(t_gc_region *region)
+{
+	t_gc_thread	*self;
+	t_gc_thread	*thread;
+	int			stack_var;
+
+	__builtin_unwind_init();
+	self = *get_gc_thread_self();
+	thread = get_gc_world()->threads;
+	while (thread)
+	{
+		if (thread == self)
+			scan_between(region, &stack_var, thread->stack_base);
+		else if (thread->stack_ptr)
+			scan_between(region, thread->stack_ptr, thread->stack_base);
+		thread = thread->next;
+	}
+}
+
+static void	scan_ranges(t_gc_region *region, t_gc_range_list *list)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < list->count)
+	{
+		gc_region_find_refs(region, list->items[i].start,
+			list->items[i].size);
+		i++;
+	}
+}
+
+//!/* Runs with the world stopped: marks every chunk that the stacks, the */
+//!/* roots, the heap or another open region points into */
+void	gc_region_find_escapes(t_gc_region *region)
+{
+	t_collecter	*chunk;
+
+	chunk = region->chunks;
+	while (chunk)
+	{
+		chunk->is_marked = 0;
+		chunk->dirty = 0;
+		chunk = chunk->next;
+	}
+	scan_stacks(region);
+	scan_ranges(region, &get_gc_roots()->segments);
+	scan_ranges(region, &get_gc_roots()->user);
+	gc_region_scan_heap(region);
+}
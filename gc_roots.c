@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_roots.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:20:20 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:36:24 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+int	gc_range_list_add(t_gc_range_list *list, void *start, size_t size)
+{
+	t_gc_grey	*items;
+	size_t		capacity;
+
+	if (list->count == list->capacity)
+	{
+		capacity = list->capacity * 2;
+		if (capacity == 0)
+			capacity = 16;
+		items = realloc(list->items, capacity * sizeof(t_gc_grey));
+		if (!items)
+			return (0);
+		list->items = items;
+		list->capacity = capacity;
+	}
+	list->items[list->count].start = start;
+	list->items[list->count].size = size;
+	list->items[list->count].flags = 0;
+	list->count++;
+	return (1);
+}
+
+static void	scan_ranges(t_gc_range_list *list)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < list->count)
+	{
+		mark_memory_region(list->items[i].start, list->items[i].size);
+		i++;
+	}
+}
+
+//!/* Runs with the world stopped, from the list cached by gc_roots_refresh */
+//!/* Open regions are not on the heap: their chunks are roots, as are the */
+//!/* objects waiting for their finalizer */
+void	gc_roots_scan(void)
+{
+	t_gc_roots	*roots;
+
+	roots = get_gc_roots();
+	scan_ranges(&roots->segments);
+	scan_ranges(&roots->user);
+	gc_region_scan_roots();
+	gc_finalize_scan_roots();
+}
+
+//!/* ptr is kept as given so gc_remove_root can find it again */
+int	gc_add_root(void *ptr, size_t size)
+{
+	int	added;
+
+	if (!ptr || size < sizeof(void *))
+		return (0);
+	gc_lock();
+	added = gc_range_list_add(&get_gc_roots()->user, ptr, size);
+	gc_unlock();
+	return (added);
+}
+
+//!/* Removes the range added with the same ptr, keeping the others' order */
+void	gc_remove_root(void *ptr)
+{
+	t_gc_range_list	*user;
+	size_t			i;
+
+	gc_lock();
+	user = &get_gc_roots()->user;
+	i = 0;
+	while (i < user->count && user->items[i].start != ptr)
+		i++;
+	if (i < user->count)
+	{
+		gc_memmove(user->items + i, user->items + i + 1,
+			(user->count - i - 1) * sizeof(t_gc_grey));
+		user->count--;
+	}
+	gc_unlock();
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_roots_segments.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:20:20 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:20:20 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "internal_collector.h"
+#include <link.h>
+
+static int	read_counters(struct dl_phdr_info *info, size_t size, void *data)
+{
+	t_gc_roots	*seen;
+
+	(void)size;
+	seen = data;
+	seen->adds = info->dlpi_adds;
+	seen->subs = info->dlpi_subs;
+	return (1);
+}
+
+//!/* Writable PT_LOAD segments hold .data and .bss of every loaded object */
+static int	add_segments(struct dl_phdr_info *info, size_t size, void *data)
+{
+	t_gc_range_list	*segments;
+	size_t			i;
+	char			*start;
+
+	(void)size;
+	segments = data;
+	i = 0;
+	while (i < info->dlpi_phnum)
+	{
+		start = (char *)info->dlpi_addr + info->dlpi_phdr[i].p_vaddr;
+		if (info->dlpi_phdr[i].p_type == PT_LOAD
+			&& (info->dlpi_phdr[i].p_flags & PF_W)
+			&& !gc_range_list_add(segments, start,
+				info->dlpi_phdr[i].p_memsz))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+//!/* Called before the world stops: a suspended thread may hold the */
+//!/* loader lock. The list is rebuilt only after a dlopen or dlclose, */
+//!/* or when the last rebuild ran out of memory */
+void	gc_roots_refresh(void)
+{
+	t_gc_roots	*roots;
+	t_gc_roots	seen;
+
+	roots = get_gc_roots();
+	dl_iterate_phdr(read_counters, &seen);
+	if (roots->cached && seen.adds == roots->adds && seen.subs == roots->subs)
+		return ;
+	roots->segments.count = 0;
+	roots->cached = (dl_iterate_phdr(add_segments, &roots->segments) == 0);
+	roots->adds = seen.adds;
+	roots->subs = seen.subs;
+}
+
+void	gc_roots_release(void)
+{
+	t_gc_roots	*roots;
+
+	roots = get_gc_roots();
+	free(roots->segments.items);
+	free(roots->user.items);
+	gc_memset(roots, 0, sizeof(t_gc_roots));
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_scan.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:24:13 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:24:13 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* The portable kernel, also used for the tails of the vector ones */
+void	gc_scan_words(void **words, size_t count, const t_gc_filter *filter)
+{
+	size_t		i;
+	uintptr_t	word;
+
+	i = 0;
+	while (i < count)
+	{
+		word = (uintptr_t)words[i];
+		if ((((word - filter->min) >> filter->shift)
+				| (word & filter->align)) == 0)
+			mark_pointer(words[i]);
+		i++;
+	}
+}
+
+//!/* Interior pages, interior blocks or the global setting allow any address */
+static int	interior_possible(t_gc_heap *heap)
+{
+	size_t	size_class;
+
+	if (get_gc_config()->interior_pointers
+		|| get_gc_index()->interior_count > 0)
+		return (1);
+	size_class = 0;
+	while (size_class < GC_CLASS_COUNT)
+	{
+		if (heap->pages[GC_FLAG_INTERIOR][size_class])
+			return (1);
+		size_class++;
+	}
+	return (0);
+}
+
+//!/* Smallest shift that maps every offset below span to zero */
+static uintptr_t	span_shift(uintptr_t span)
+{
+	uintptr_t	shift;
+
+	shift = 0;
+	while (shift < GC_WORD_BITS - 1 && ((span - 1) >> shift) != 0)
+		shift++;
+	return (shift);
+}
+
+//!/* Large blocks live in malloc memory, possibly far from the pages */
+static void	heap_bounds(t_gc_heap *heap, uintptr_t *min, uintptr_t *max)
+{
+	t_gc_index	*index;
+
+	index = get_gc_index();
+	*min = heap->min;
+	*max = heap->max;
+	if (!index->valid)
+	{
+		*min = 0;
+		*max = UINTPTR_MAX;
+	}
+	else if (index->count > 0 && (*max == 0 || index->min < *min))
+		*min = index->min;
+	if (index->valid && index->max > *max)
+		*max = index->max;
+}
+
+//!/* Runs after the index build, before the world stops */
+//!/* An empty heap leaves a filter that only lets NULL through */
+void	gc_filter_update(void)
+{
+	t_gc_heap	*heap;
+	uintptr_t	min;
+	uintptr_t	max;
+
+	heap = get_gc_heap();
+	heap_bounds(heap, &min, &max);
+	heap->filter.min = min;
+	heap->filter.shift = 0;
+	heap->filter.align = ~(uintptr_t)0;
+	if (max > min)
+	{
+		heap->filter.shift = span_shift(max - min);
+		heap->filter.align = sizeof(void *) - 1;
+		if (interior_possible(heap))
+			heap->filter.align = 0;
+	}
+	heap->filter.scan = gc_scan_select_simd();
+	if (!heap->filter.scan)
+		heap->filter.scan = gc_scan_words;
+}
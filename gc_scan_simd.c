@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_scan_simd.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:24:24 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:24:24 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+#if defined(__x86_64__)
+
+# include <immintrin.h>
+
+//!/* Two words per step: SSE2 has no 64-bit compare, but the filter only */
+//!/* needs a subtract, a shift and an equality test, which it does have */
+__attribute__((target("sse2")))
+static void	scan_sse2(void **words, size_t count, const t_gc_filter *filter)
+{
+	__m128i	min;
+	__m128i	align;
+	__m128i	shift;
+	__m128i	word;
+	int		hits;
+	size_t	i;
+
+	min = _mm_set1_epi64x((long long)filter->min);
+	align = _mm_set1_epi64x((long long)filter->align);
+	shift = _mm_cvtsi64_si128((long long)filter->shift);
+	i = 0;
+	while (i + 2 <= count)
+	{
+		word = _mm_loadu_si128((const __m128i *)(words + i));
+		word = _mm_or_si128(_mm_srl_epi64(_mm_sub_epi64(word, min), shift),
+				_mm_and_si128(word, align));
+		hits = _mm_movemask_epi8(_mm_cmpeq_epi32(word, _mm_setzero_si128()));
+		if ((hits & 0xFF) == 0xFF)
+			mark_pointer(words[i]);
+		if ((hits & 0xFF00) == 0xFF00)
+			mark_pointer(words[i + 1]);
+		i += 2;
+	}
+	gc_scan_words(words + i, count - i, filter);
+}
+
+//!/* Four words per step; most steps find no candidate and fall through */
+__attribute__((target("avx2")))
+static void	scan_avx2(void **words, size_t count, const t_gc_filter *filter)
+{
+	__m256i	min;
+	__m256i	align;
+	__m128i	shift;
+	__m256i	word;
+	int		hits;
+	size_t	i;
+
+	min = _mm256_set1_epi64x((long long)filter->min);
+	align = _mm256_set1_epi64x((long long)filter->align);
+	shift = _mm_cvtsi64_si128((long long)filter->shift);
+	i = 0;
+	while (i + 4 <= count)
+	{
+		word = _mm256_loadu_si256((const __m256i *)(words + i));
+		word = _mm256_or_si256(_mm256_srl_epi64(_mm256_sub_epi64(word, min),
+					shift), _mm256_and_si256(word, align));
+		hits = _mm256_movemask_pd(_mm256_castsi256_pd(
+					_mm256_cmpeq_epi64(word, _mm256_setzero_si256())));
+		if (hits)
+			gc_scan_words(words + i, 4, filter);
+		i += 4;
+	}
+	gc_scan_words(words + i, count - i, filter);
+}
+
+//!/* SSE2 is part of x86-64, AVX2 is detected at runtime */
+t_gc_scan_fn	gc_scan_select_simd(void)
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return (scan_avx2);
+	return (scan_sse2);
+}
+
+#else
+
+//!/* Other targets keep the portable kernel */
+t_gc_scan_fn	gc_scan_select_simd(void)
+{
+	return (NULL);
+}
+
+#endif
@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_size_class.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:55:33 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 22:55:33 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* 16-byte steps up to 256, 128-byte steps to 1024, 256-byte steps after */
+size_t	gc_size_class(size_t size)
+{
+	if (size <= 256)
+		return ((size + 15) / 16 - 1);
+	if (size <= 1024)
+		return (15 + (size - 256 + 127) / 128);
+	return (21 + (size - 1024 + 255) / 256);
+}
+
+size_t	gc_class_size(size_t size_class)
+{
+	if (size_class < 16)
+		return ((size_class + 1) * 16);
+	if (size_class < 22)
+		return (256 + (size_class - 15) * 128);
+	return (1024 + (size_class - 21) * 256);
+}
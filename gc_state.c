@@ -6,22 +6,69 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 17:12:56 by akivam            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 01:15:14 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+
 #include "internal_collector.h"
 
 t_collecter	**get_gc_head(void)
 {
 	static t_collecter	*head = NULL;
+	t_gc_instance		*instance;
 
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->head);
 	return (&head);
 }
 
+//!/* The main thread's stack, set by collector_init and shared by every */
+//!/* instance */
 void	**get_gc_stack_start(void)
 {
 	static void	*stack_start = NULL;
 
 	return (&stack_start);
 }
+
+t_gc_index	*get_gc_index(void)
+{
+	static t_gc_index	index = {NULL, 0, 0, 0, 0, 0, 0};
+	t_gc_instance		*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->index);
+	return (&index);
+}
+
+t_gc_config	*get_gc_config(void)
+{
+	static t_gc_config	config = {0, {GC_DEFAULT_MIN_HEAP, 1.0, 0}, 0, 0, 1, 0,
+		GC_DEFAULT_LARGE_THRESHOLD, NULL, NULL, 0, 0, 0, 0};
+	t_gc_instance		*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->config);
+	return (&config);
+}
+
+//!/* Helper markers have their own deque; everyone else shares the one */
+//!/* of the current instance */
+t_gc_mark_stack	*get_gc_mark_stack(void)
+{
+	static t_gc_mark_stack	stack = {NULL, 0, 0, 0, 0, 0, 0, 0, 0};
+	t_gc_mark_stack			*self;
+	t_gc_instance			*instance;
+
+	self = *get_gc_marker_self();
+	if (self)
+		return (self);
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->stack);
+	return (&stack);
+}
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_state_alloc.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:31:24 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:36:24 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "internal_collector.h"
+
+//!/* Set by every allocation of the thread: its memory is still zeroed */
+int	*get_gc_fresh(void)
+{
+	static __thread int	fresh;
+
+	return (&fresh);
+}
+
+t_gc_stats	*get_gc_stats_state(void)
+{
+	static t_gc_stats	stats;
+	t_gc_instance		*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->stats);
+	return (&stats);
+}
+
+//!/* Innermost region open on the thread, NULL outside gc_region_begin */
+t_gc_region	**get_gc_region_self(void)
+{
+	static __thread t_gc_region	*region;
+
+	return (&region);
+}
+
+t_gc_finalize	*get_gc_finalize(void)
+{
+	static t_gc_finalize	finalize;
+	t_gc_instance			*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->finalize);
+	return (&finalize);
+}
+
+//!/* Set while the thread runs finalizers, which don't nest */
+int	*get_gc_finalizing(void)
+{
+	static __thread int	finalizing;
+
+	return (&finalizing);
+}
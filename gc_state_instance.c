@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_state_instance.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:49:39 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Instance the getters resolve to on this thread, NULL for the default */
+t_gc_instance	**get_gc_current(void)
+{
+	static __thread t_gc_instance	*current;
+
+	return (&current);
+}
+
+//!/* Instances made by gc_create, for the fault handler to search */
+t_gc_instance	**get_gc_instances(void)
+{
+	static t_gc_instance	*instances = NULL;
+
+	return (&instances);
+}
+
+//!/* Makes instance current on this thread and returns the previous one */
+t_gc_instance	*gc_instance_switch(t_gc_instance *instance)
+{
+	t_gc_instance	**current;
+	t_gc_instance	*previous;
+
+	current = get_gc_current();
+	previous = *current;
+	*current = instance;
+	return (previous);
+}
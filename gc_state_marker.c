@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_state_marker.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:20 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "internal_collector.h"
+
+//!/* The mutex and condition variables are set up by gc_markers_start */
+t_gc_markers	*get_gc_markers(void)
+{
+	static t_gc_markers	markers;
+	t_gc_instance		*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->markers);
+	return (&markers);
+}
+
+t_gc_mark_stack	**get_gc_marker_self(void)
+{
+	static __thread t_gc_mark_stack	*self;
+
+	return (&self);
+}
+
+//!/* The mutex and condition variable are set up with the first thread */
+t_gc_concurrent	*get_gc_concurrent(void)
+{
+	static t_gc_concurrent	concurrent;
+	t_gc_instance			*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->concurrent);
+	return (&concurrent);
+}
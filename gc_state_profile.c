@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_state_profile.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:27:30 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:27:30 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+t_gc_profile	*get_gc_profile(void)
+{
+	static t_gc_profile	profile;
+	t_gc_instance		*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->profile);
+	return (&profile);
+}
+
+//!/* Countdown of the calling thread, whichever instance it allocates from */
+t_gc_sampler	*get_gc_sampler(void)
+{
+	static __thread t_gc_sampler	sampler;
+
+	return (&sampler);
+}
+
+//!/* Mean sampling interval shared by every instance, 0 while off */
+size_t	*get_gc_profile_period(void)
+{
+	static size_t	period = 0;
+
+	return (&period);
+}
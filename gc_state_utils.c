@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_state_utils.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:55:33 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "internal_collector.h"
+
+t_gc_heap	*get_gc_heap(void)
+{
+	static t_gc_heap	heap;
+	t_gc_instance		*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->heap);
+	return (&heap);
+}
+
+t_gc_world	*get_gc_world(void)
+{
+	static t_gc_world	world;
+
+	return (&world);
+}
+
+t_gc_thread	**get_gc_thread_self(void)
+{
+	static __thread t_gc_thread	*self;
+
+	return (&self);
+}
+
+//!/* Allocation context of unregistered threads, used under the lock only; */
+//!/* every thread allocates from it in instances made by gc_create */
+t_gc_thread	*get_gc_shared_thread(void)
+{
+	static t_gc_thread	shared;
+	t_gc_instance		*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->shared);
+	return (&shared);
+}
+
+t_gc_roots	*get_gc_roots(void)
+{
+	static t_gc_roots	roots;
+	t_gc_instance		*instance;
+
+	instance = *get_gc_current();
+	if (instance)
+		return (&instance->roots);
+	return (&roots);
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_stats.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:36:16 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 00:55:45 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Bucket i holds sizes up to 16 << i; the last one takes the rest */
+size_t	gc_stats_bucket(size_t size)
+{
+	size_t	bucket;
+
+	if (size <= 16)
+		return (0);
+	bucket = GC_WORD_BITS - __builtin_clzl(size - 1) - 4;
+	if (bucket >= GC_STATS_BUCKETS)
+		bucket = GC_STATS_BUCKETS - 1;
+	return (bucket);
+}
+
+//!/* Called with the lock held whenever pages or large blocks are added */
+void	gc_stats_heap_grew(void)
+{
+	t_gc_heap	*heap;
+	t_gc_stats	*stats;
+	size_t		held;
+
+	heap = get_gc_heap();
+	stats = get_gc_stats_state();
+	held = heap->page_count * GC_PAGE_SIZE + heap->large_bytes;
+	if (held > stats->peak_heap_bytes)
+		stats->peak_heap_bytes = held;
+}
+
+//!/* Called with the lock held when a thread gives its TLAB back */
+void	gc_stats_fold_thread(t_gc_thread *thread)
+{
+	t_gc_stats	*stats;
+	size_t		bucket;
+
+	stats = get_gc_stats_state();
+	bucket = 0;
+	while (bucket < GC_STATS_BUCKETS)
+	{
+		stats->allocs[bucket] += thread->allocs[bucket];
+		thread->allocs[bucket] = 0;
+		bucket++;
+	}
+}
+
+//!/* Threads still running report the counts of their own TLAB */
+static void	add_thread_allocs(t_gc_stats *stats, t_gc_thread *thread)
+{
+	size_t	bucket;
+
+	bucket = 0;
+	while (bucket < GC_STATS_BUCKETS)
+	{
+		stats->allocs[bucket] += thread->allocs[bucket];
+		bucket++;
+	}
+}
+
+void	gc_get_stats(t_gc_stats *stats)
+{
+	t_gc_heap	*heap;
+	t_gc_thread	*thread;
+
+	if (!stats)
+		return ;
+	gc_lock();
+	heap = get_gc_heap();
+	*stats = *get_gc_stats_state();
+	stats->heap_bytes = heap->page_count * GC_PAGE_SIZE + heap->large_bytes;
+	stats->live_bytes = heap->live_bytes;
+	add_thread_allocs(stats, get_gc_shared_thread());
+	thread = NULL;
+	if (!*get_gc_current())
+		thread = get_gc_world()->threads;
+	while (thread)
+	{
+		add_thread_allocs(stats, thread);
+		thread = thread->next;
+	}
+	gc_unlock();
+}
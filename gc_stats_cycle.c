@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_stats_cycle.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:36:16 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:50:58 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <time.h>
+
+unsigned long long	gc_now_ns(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((unsigned long long)now.tv_sec * 1000000000ULL
+		+ (unsigned long long)now.tv_nsec);
+}
+
+//!/* Noise words land in objects as often as objects fill the address */
+//!/* range the filter passes; each miss suggests occupancy / (1 - occupancy) */
+//!/* lucky hits */
+static size_t	estimate_false_refs(t_gc_heap *heap, size_t misses,
+		size_t live_bytes)
+{
+	double	range;
+	double	occupancy;
+
+	range = (double)((uintptr_t)1 << heap->filter.shift);
+	occupancy = (double)live_bytes / range;
+	if (occupancy > 0.99)
+		occupancy = 0.99;
+	return ((size_t)((double)misses * occupancy / (1.0 - occupancy)));
+}
+
+//!/* Runs with the world stopped, after every marker has finished */
+void	gc_stats_mark_done(void)
+{
+	t_gc_heap		*heap;
+	t_gc_stats		*stats;
+	t_gc_mark_stack	*stack;
+
+	heap = get_gc_heap();
+	stats = get_gc_stats_state();
+	stack = get_gc_mark_stack();
+	if (!heap->minor)
+		stats->live_objects = 0;
+	stats->live_objects += stack->marked_objects;
+	stats->near_misses = stack->misses;
+	if (heap->minor)
+		stats->false_refs = estimate_false_refs(heap, stack->misses,
+				heap->live_bytes + heap->marked_bytes);
+	else
+		stats->false_refs = estimate_false_refs(heap, stack->misses,
+				heap->marked_bytes);
+	stack->marked_objects = 0;
+	stack->misses = 0;
+}
+
+void	gc_stats_pause(unsigned long long ns)
+{
+	t_gc_stats	*stats;
+
+	stats = get_gc_stats_state();
+	stats->pauses++;
+	stats->stop_ns += ns;
+	if (ns > stats->max_stop_ns)
+		stats->max_stop_ns = ns;
+}
+
+void	gc_stats_cycle(unsigned long long mark_ns, unsigned long long sweep_ns)
+{
+	t_gc_stats	*stats;
+
+	stats = get_gc_stats_state();
+	stats->collections++;
+	stats->minor_collections += (get_gc_heap()->minor != 0);
+	stats->mark_ns += mark_ns;
+	stats->sweep_ns += sweep_ns;
+	stats->last_mark_ns = mark_ns;
+	stats->last_sweep_ns = sweep_ns;
+	if (mark_ns + sweep_ns > stats->max_pause_ns)
+		stats->max_pause_ns = mark_ns + sweep_ns;
+	if (get_gc_config()->log)
+		gc_stats_log(stats, get_gc_heap()->minor);
+}
@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_stats_event.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:37:08 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:21:24 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+void	gc_stats_event(t_gc_event event)
+{
+	t_gc_config	*config;
+
+	config = get_gc_config();
+	if (config->on_event)
+		config->on_event(event, config->event_arg);
+}
+
+void	gc_set_event_callback(t_gc_event_fn fn, void *arg)
+{
+	t_gc_config	*config;
+
+	gc_lock();
+	config = get_gc_config();
+	config->on_event = fn;
+	config->event_arg = arg;
+	gc_unlock();
+}
+
+//!/* Called with the lock held once the instance has freed every object, */
+//!/* so a later collector_init starts counting from zero */
+void	gc_stats_release(void)
+{
+	gc_memset(get_gc_stats_state(), 0, sizeof(t_gc_stats));
+}
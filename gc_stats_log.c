@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_stats_log.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:36:28 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:36:28 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <unistd.h>
+
+static void	put_str(char *buf, size_t *len, const char *str)
+{
+	while (*str && *len < 255)
+		buf[(*len)++] = *str++;
+}
+
+static void	put_num(char *buf, size_t *len, unsigned long long n)
+{
+	char	digits[20];
+	size_t	count;
+
+	count = 0;
+	while (count == 0 || n > 0)
+	{
+		digits[count++] = (char)('0' + n % 10);
+		n /= 10;
+	}
+	while (count > 0 && *len < 255)
+		buf[(*len)++] = digits[--count];
+}
+
+//!/* Milliseconds with three decimals */
+static void	put_ms(char *buf, size_t *len, unsigned long long ns)
+{
+	put_num(buf, len, ns / 1000000);
+	put_str(buf, len, ".");
+	put_num(buf, len, ns / 100000 % 10);
+	put_num(buf, len, ns / 10000 % 10);
+	put_num(buf, len, ns / 1000 % 10);
+	put_str(buf, len, " ms");
+}
+
+//!/* One line per collection on stderr, enabled by the GC_LOG variable */
+void	gc_stats_log(const t_gc_stats *stats, int minor)
+{
+	t_gc_heap	*heap;
+	char		buf[256];
+	size_t		len;
+
+	heap = get_gc_heap();
+	len = 0;
+	put_str(buf, &len, "gc #");
+	put_num(buf, &len, stats->collections);
+	if (minor)
+		put_str(buf, &len, " minor");
+	put_str(buf, &len, ": mark ");
+	put_ms(buf, &len, stats->last_mark_ns);
+	put_str(buf, &len, ", sweep ");
+	put_ms(buf, &len, stats->last_sweep_ns);
+	put_str(buf, &len, ", live ");
+	put_num(buf, &len, heap->live_bytes / 1024);
+	put_str(buf, &len, " KiB, heap ");
+	put_num(buf, &len, (heap->page_count * GC_PAGE_SIZE
+			+ heap->large_bytes) / 1024);
+	put_str(buf, &len, " KiB, freed ");
+	put_num(buf, &len, stats->freed_objects);
+	put_str(buf, &len, " objects\n");
+	if (write(STDERR_FILENO, buf, len) < 0)
+		return ;
+}
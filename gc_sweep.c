@@ -6,42 +6,81 @@
 /*   By: harici <harici@student.42istanbul.com.t    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 20:34:50 by harici            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 01:36:24 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "internal_collector.h"
 
-static void	sweep_unmarked(t_collecter **head_ptr, t_collecter **prev,
-		t_collecter *current, t_collecter *next)
+static void	sweep_unmarked(t_collecter **link, t_collecter *current)
 {
-	if (*prev)
-		(*prev)->next = next;
-	else
-		*head_ptr = next;
-	free(current);
+	get_gc_stats_state()->freed_objects++;
+	get_gc_stats_state()->freed_bytes += sizeof(t_collecter) + current->size;
+	*link = current->next;
+	if (current->next)
+		current->next->prev = current->prev;
+	gc_large_free(current);
 }
 
-void	gc_sweep(void)
+//!/* Sweeps up to *budget blocks from large_cursor, NULL once the list ends */
+size_t	gc_sweep_large_blocks(size_t *budget)
 {
-	t_collecter	**head_ptr;
+	t_gc_heap	*heap;
+	t_collecter	**link;
 	t_collecter	*current;
-	t_collecter	*prev;
-	t_collecter	*next;
+	size_t		live_bytes;
 
-	head_ptr = get_gc_head();
-	current = *head_ptr;
-	prev = NULL;
-	while (current)
+	heap = get_gc_heap();
+	link = heap->large_cursor;
+	live_bytes = 0;
+	while (link && *link && *budget > 0)
 	{
-		next = current->next;
+		current = *link;
 		if (!current->is_marked)
-			sweep_unmarked(head_ptr, &prev, current, next);
+			sweep_unmarked(link, current);
 		else
 		{
-			current->is_marked = 0;
-			prev = current;
+			current->is_marked = heap->sticky;
+			live_bytes += sizeof(t_collecter) + current->size;
+			link = &current->next;
 		}
-		current = next;
+		(*budget)--;
 	}
+	if (link && !*link)
+		link = NULL;
+	heap->large_cursor = link;
+	return (live_bytes);
+}
+
+void	gc_sweep(void)
+{
+	t_gc_heap	*heap;
+	size_t		budget;
+
+	heap = get_gc_heap();
+	budget = (size_t)-1;
+	heap->large_cursor = get_gc_head();
+	heap->live_bytes = gc_sweep_pages() + gc_sweep_large_blocks(&budget);
+	heap->allocated_bytes = 0;
+	get_gc_index()->valid = 0;
+}
+
+//!/* Sweeping runs under the lock after the world restarts; stale pages */
+//!/* keep owners off the lock-free fast path until they are swept. Weak */
+//!/* references, finalizers and the profiler read the marks first */
+void	gc_collect_sweep(unsigned long long mark_ns, int lazy)
+{
+	unsigned long long	start;
+
+	gc_stats_event(GC_EVENT_SWEEP_BEGIN);
+	gc_finalize_collect();
+	gc_profile_collect();
+	start = gc_now_ns();
+	if (lazy)
+		gc_sweep_lazy();
+	else
+		gc_sweep();
+	gc_generation_end();
+	gc_stats_cycle(mark_ns, gc_now_ns() - start);
+	gc_stats_event(GC_EVENT_SWEEP_END);
 }
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_sweep_pages.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:55:33 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:37:09 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* alloc &= mark frees every unmarked slot of the page at once */
+//!/* Sticky marks are kept: the survivors are the old generation */
+//!/* The epoch is published last: the owner's fast path checks it unlocked */
+//!/* Slots allocated before the sweep and not kept count as freed */
+size_t	gc_page_sweep(t_gc_page *page)
+{
+	t_gc_heap	*heap;
+	size_t		word;
+	size_t		live;
+
+	heap = get_gc_heap();
+	if (page->sweep_epoch != heap->epoch && heap->unswept > 0)
+		heap->unswept--;
+	word = 0;
+	live = 0;
+	while (word < page->words)
+	{
+		page->alloc_bits[word] &= page->mark_bits[word];
+		if (!heap->sticky)
+			page->mark_bits[word] = 0;
+		live += __builtin_popcountl(page->alloc_bits[word]);
+		word++;
+	}
+	get_gc_stats_state()->freed_objects += page->live_count - live;
+	get_gc_stats_state()->freed_bytes += (page->live_count - live)
+		* page->obj_size;
+	page->live_count = live;
+	page->cursor = 0;
+	__atomic_store_n(&page->sweep_epoch, heap->epoch, __ATOMIC_RELEASE);
+	return (live);
+}
+
+static size_t	sweep_class(t_gc_heap *heap, size_t kind, size_t size_class)
+{
+	t_gc_page	**link;
+	t_gc_page	*page;
+	t_gc_page	*prev;
+	size_t		live_bytes;
+
+	link = &heap->pages[kind][size_class];
+	prev = NULL;
+	live_bytes = 0;
+	while (*link)
+	{
+		page = *link;
+		if (page->sweep_epoch != heap->epoch)
+			gc_page_sweep(page);
+		live_bytes += page->live_count * page->obj_size;
+		if (page->live_count == 0 && !page->owner)
+		{
+			*link = page->next;
+			gc_page_destroy(page);
+			continue ;
+		}
+		prev = page;
+		link = &page->next;
+	}
+	heap->last[kind][size_class] = prev;
+	return (live_bytes);
+}
+
+//!/* Sweeps pages left unswept, frees empty ones, returns the bytes in use */
+size_t	gc_sweep_pages(void)
+{
+	t_gc_heap	*heap;
+	size_t		kind;
+	size_t		size_class;
+	size_t		live_bytes;
+
+	heap = get_gc_heap();
+	live_bytes = 0;
+	kind = 0;
+	while (kind < GC_KIND_COUNT)
+	{
+		size_class = 0;
+		while (size_class < GC_CLASS_COUNT)
+		{
+			live_bytes += sweep_class(heap, kind, size_class);
+			size_class++;
+		}
+		kind++;
+	}
+	gc_heap_rewind();
+	return (live_bytes);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_thread.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:06:14 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:37:09 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "internal_collector.h"
+
+static void	*find_stack_base(void)
+{
+	pthread_attr_t	attr;
+	void			*addr;
+	size_t			size;
+
+	if (pthread_getattr_np(pthread_self(), &attr) != 0)
+		return (NULL);
+	addr = NULL;
+	size = 0;
+	if (pthread_attr_getstack(&attr, &addr, &size) != 0)
+		addr = NULL;
+	pthread_attr_destroy(&attr);
+	if (!addr)
+		return (NULL);
+	return ((char *)addr + size);
+}
+
+//!/* self is set first: a signal may arrive as soon as the thread is linked */
+static int	link_thread(t_gc_thread *thread)
+{
+	t_gc_world	*world;
+
+	gc_lock();
+	world = get_gc_world();
+	if (!gc_world_init())
+	{
+		gc_unlock();
+		return (0);
+	}
+	*get_gc_thread_self() = thread;
+	thread->next = world->threads;
+	world->threads = thread;
+	gc_unlock();
+	return (1);
+}
+
+//!/* Called with the lock held; the pages go back to the shared lists */
+void	gc_thread_release_tlab(t_gc_thread *thread)
+{
+	size_t	kind;
+	size_t	size_class;
+
+	kind = 0;
+	while (kind < GC_KIND_COUNT)
+	{
+		size_class = 0;
+		while (size_class < GC_CLASS_COUNT)
+		{
+			if (thread->tlab[kind][size_class])
+				thread->tlab[kind][size_class]->owner = NULL;
+			thread->tlab[kind][size_class] = NULL;
+			size_class++;
+		}
+		kind++;
+	}
+	get_gc_heap()->allocated_bytes += thread->allocated;
+	thread->allocated = 0;
+	gc_stats_fold_thread(thread);
+}
+
+int	gc_register_thread(void *stack_start)
+{
+	t_gc_thread	**self;
+	t_gc_thread	*thread;
+
+	self = get_gc_thread_self();
+	if (!stack_start)
+		stack_start = find_stack_base();
+	if (!stack_start)
+		return (0);
+	if (*self)
+	{
+		(*self)->stack_base = stack_start;
+		return (1);
+	}
+	thread = calloc(1, sizeof(t_gc_thread));
+	if (!thread)
+		return (0);
+	thread->id = pthread_self();
+	thread->stack_base = stack_start;
+	if (!link_thread(thread))
+	{
+		free(thread);
+		return (0);
+	}
+	return (1);
+}
+
+void	gc_unregister_thread(void)
+{
+	t_gc_thread	**self;
+	t_gc_thread	**link;
+
+	self = get_gc_thread_self();
+	if (!*self)
+		return ;
+	gc_lock();
+	gc_thread_release_tlab(*self);
+	link = &get_gc_world()->threads;
+	while (*link && *link != *self)
+		link = &(*link)->next;
+	if (*link)
+		*link = (*self)->next;
+	gc_unlock();
+	free(*self);
+	*self = NULL;
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_tlab.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:06:27 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:36:24 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Lock-free: between two collections only the owner touches its pages */
+//!/* The byte count is bumped before a pending suspend can zero it */
+static void	*alloc_fast(t_gc_thread *self, size_t size_class,
+		unsigned char flags)
+{
+	t_gc_page	*page;
+	void		*ptr;
+
+	ptr = NULL;
+	self->in_alloc = 1;
+	__atomic_signal_fence(__ATOMIC_SEQ_CST);
+	page = self->tlab[flags][size_class];
+	if (page && __atomic_load_n(&page->sweep_epoch, __ATOMIC_ACQUIRE)
+		== get_gc_heap()->epoch)
+		ptr = gc_page_take_slot(page);
+	if (ptr)
+		self->allocated += gc_class_size(size_class);
+	__atomic_signal_fence(__ATOMIC_SEQ_CST);
+	self->in_alloc = 0;
+	__atomic_signal_fence(__ATOMIC_SEQ_CST);
+	if (self->suspend_pending)
+	{
+		self->suspend_pending = 0;
+		gc_thread_park(self);
+	}
+	return (ptr);
+}
+
+static void	*take_from_tlab(t_gc_thread *self, size_t size_class,
+		unsigned char flags)
+{
+	t_gc_page	*page;
+
+	page = self->tlab[flags][size_class];
+	if (!page)
+		return (NULL);
+	if (page->sweep_epoch != get_gc_heap()->epoch)
+		gc_page_sweep(page);
+	return (gc_page_take_slot(page));
+}
+
+//!/* Called with the lock held; flushing the byte count may collect */
+static void	*refill(t_gc_thread *self, size_t size_class, unsigned char flags)
+{
+	t_gc_page	*page;
+	void		*ptr;
+
+	get_gc_heap()->allocated_bytes += self->allocated;
+	self->allocated = 0;
+	if (!gc_policy_admit(gc_class_size(size_class)))
+		return (NULL);
+	ptr = take_from_tlab(self, size_class, flags);
+	if (ptr)
+		return (ptr);
+	page = self->tlab[flags][size_class];
+	if (page)
+		page->owner = NULL;
+	self->tlab[flags][size_class] = NULL;
+	page = gc_page_acquire(size_class, flags);
+	if (!page)
+		return (NULL);
+	page->owner = self;
+	self->tlab[flags][size_class] = page;
+	return (gc_page_take_slot(page));
+}
+
+static void	*counted(t_gc_thread *self, size_t size, void *ptr)
+{
+	if (ptr)
+		self->allocs[gc_stats_bucket(size)]++;
+	return (ptr);
+}
+
+//!/* Unregistered threads share one allocation context under the lock, */
+//!/* as do all threads in an instance made by gc_create. Finalizers a */
+//!/* collection readied run after the slow path */
+void	*gc_alloc_small(size_t size, unsigned char flags)
+{
+	t_gc_thread	*self;
+	size_t		size_class;
+	void		*ptr;
+
+	size_class = gc_size_class(size);
+	self = *get_gc_thread_self();
+	if (self && *get_gc_current())
+		self = NULL;
+	if (self)
+	{
+		ptr = alloc_fast(self, size_class, flags);
+		if (ptr)
+			return (counted(self, size, ptr));
+	}
+	else
+		self = get_gc_shared_thread();
+	gc_lock();
+	ptr = counted(self, size, refill(self, size_class, flags));
+	if (ptr)
+		get_gc_heap()->allocated_bytes += gc_class_size(size_class);
+	gc_unlock();
+	gc_finalize_pending();
+	return (ptr);
+}
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_trim.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:27:03 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:50:58 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __GLIBC__
+# include <malloc.h>
+#endif
+
+//!/* Slots first to last, clamped to the page, are all free */
+static int	slots_free(t_gc_page *page, size_t first, size_t last)
+{
+	if (last >= page->obj_count)
+		last = page->obj_count - 1;
+	while (first <= last)
+	{
+		if (page->alloc_bits[first / GC_WORD_BITS]
+			& (1UL << (first % GC_WORD_BITS)))
+			return (0);
+		first++;
+	}
+	return (1);
+}
+
+//!/* Only resident kernel pages are counted and released */
+static size_t	trim_page(t_gc_page *page, size_t os_page)
+{
+	unsigned char	resident[GC_PAGE_SIZE / 4096];
+	size_t			offset;
+	size_t			released;
+
+	if (mincore(page->base, GC_PAGE_SIZE, resident) != 0)
+		return (0);
+	offset = 0;
+	released = 0;
+	while (offset + os_page <= GC_PAGE_SIZE)
+	{
+		if ((resident[offset / os_page] & 1)
+			&& slots_free(page, offset / page->obj_size,
+				(offset + os_page - 1) / page->obj_size)
+			&& madvise(page->base + offset, os_page, MADV_DONTNEED) == 0)
+			released += os_page;
+		offset += os_page;
+	}
+	return (released);
+}
+
+//!/* Pages owned by a thread are skipped: it allocates from them unlocked */
+static size_t	trim_kind(t_gc_page **lists, size_t os_page)
+{
+	t_gc_page	*page;
+	size_t		size_class;
+	size_t		released;
+
+	released = 0;
+	size_class = 0;
+	while (size_class < GC_CLASS_COUNT)
+	{
+		page = lists[size_class];
+		while (page)
+		{
+			if (!page->owner && page->live_count < page->obj_count)
+				released += trim_page(page, os_page);
+			page = page->next;
+		}
+		size_class++;
+	}
+	return (released);
+}
+
+//!/* Free slots stay free for the allocator; their memory is refaulted */
+//!/* zeroed when reused. Empty pages were already unmapped by the sweep, */
+//!/* which a running concurrent mark ends with */
+size_t	gc_trim(void)
+{
+	t_gc_heap	*heap;
+	size_t		os_page;
+	size_t		kind;
+	size_t		released;
+
+	os_page = (size_t)sysconf(_SC_PAGESIZE);
+	if (os_page < 4096 || os_page > GC_PAGE_SIZE)
+		return (0);
+	released = 0;
+	gc_lock();
+	gc_concurrent_finish();
+	gc_sweep_finish();
+	heap = get_gc_heap();
+	kind = 0;
+	while (kind < GC_KIND_COUNT)
+		released += trim_kind(heap->pages[kind++], os_page);
+	gc_unlock();
+#ifdef __GLIBC__
+	malloc_trim(0);
+#endif
+	return (released);
+}
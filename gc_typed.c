@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_typed.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:21:57 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 01:27:30 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* The layout sits in the last words of the block, after the user data */
+//!/* A thread stopped inside gc_malloc_typed may not have written it yet: */
+//!/* the object holds no pointers then */
+static void	scan_typed(void *start, size_t size)
+{
+	t_gc_layout	*layout;
+	void		**words;
+	size_t		count;
+	size_t		i;
+
+	layout = (t_gc_layout *)((char *)start + size) - 1;
+	if (layout->words == 0)
+		return ;
+	words = start;
+	count = (size - sizeof(t_gc_layout)) / sizeof(void *);
+	i = 0;
+	while (i < count)
+	{
+		if (layout->bitmap & (1UL << (i % layout->words)))
+			mark_pointer(words[i]);
+		i++;
+	}
+}
+
+//!/* Atomic objects are never pushed, but overflow rescans still see them */
+void	gc_scan_object(void *start, size_t size, unsigned char flags)
+{
+	if (flags & GC_FLAG_ATOMIC)
+		return ;
+	if (flags & GC_FLAG_TYPED)
+		scan_typed(start, size);
+	else
+		mark_memory_region(start, size);
+}
+
+//!/* Zeroed so the slack of the size class holds no stale pointers */
+void	*gc_malloc_typed(size_t size, const t_gc_layout *layout)
+{
+	void			*ptr;
+	size_t			block;
+	unsigned char	flags;
+
+	if (!layout || layout->words == 0 || layout->words > GC_WORD_BITS
+		|| size > (size_t)-1 - sizeof(t_gc_layout))
+		return (NULL);
+	ptr = gc_alloc(size + sizeof(t_gc_layout), GC_FLAG_TYPED);
+	if (!ptr)
+		return (NULL);
+	block = gc_block_size(ptr, &flags) - sizeof(t_gc_layout);
+	if (!*get_gc_fresh())
+		gc_memset(ptr, 0, block);
+	*(t_gc_layout *)((char *)ptr + block) = *layout;
+	return (gc_profile_note(ptr, size));
+}
+
+void	*gc_malloc_atomic(size_t size)
+{
+	return (gc_profile_note(gc_alloc(size, GC_FLAG_ATOMIC), size));
+}
+
+void	*gc_calloc_atomic(size_t nmemb, size_t size)
+{
+	void	*ptr;
+
+	if (nmemb == 0 || size == 0 || size > (size_t)-1 / nmemb)
+		return (NULL);
+	ptr = gc_malloc_atomic(nmemb * size);
+	if (ptr && !*get_gc_fresh())
+		gc_memset(ptr, 0, nmemb * size);
+	return (ptr);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_weak.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:36:24 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 02:04:48 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+//!/* Whether the last mark reached ptr, an object of the allocator; read */
+//!/* between a mark and its sweep */
+int	gc_is_marked(void *ptr)
+{
+	t_gc_page	*page;
+	size_t		slot;
+
+	page = gc_page_find(ptr);
+	if (!page)
+		return (get_header_from_ptr(ptr)->is_marked);
+	slot = (size_t)((char *)ptr - page->base) / page->obj_size;
+	return ((page->mark_bits[slot / GC_WORD_BITS]
+			>> (slot % GC_WORD_BITS)) & 1);
+}
+
+//!/* The handle is atomic and skips open regions: the collector reads its */
+//!/* mark bit like that of any heap object. Region objects and what the */
+//!/* instance doesn't own have no mark of their own to read */
+gc_weak_t	*gc_weak_ref_create(void *ptr)
+{
+	t_gc_weak	*ref;
+	int			owner;
+	int			added;
+
+	if (!ptr)
+		return (NULL);
+	gc_lock();
+	owner = gc_owner(ptr);
+	gc_unlock();
+	if (owner != GC_OWNER_PAGE && owner != GC_OWNER_LARGE)
+		return (NULL);
+	ref = gc_alloc_small(sizeof(t_gc_weak), GC_FLAG_ATOMIC);
+	if (!ref)
+		return (NULL);
+	gc_lock();
+	ref->target = ptr;
+	added = gc_range_list_add(&get_gc_finalize()->weak, ref, 0);
+	gc_unlock();
+	if (!added)
+		return (NULL);
+	return (ref);
+}
+
+//!/* Under the lock, so that no sweep runs between a mark that missed the */
+//!/* target and the clearing of the reference */
+void	*gc_weak_ref_get(gc_weak_t *ref)
+{
+	void	*target;
+
+	if (!ref)
+		return (NULL);
+	gc_lock();
+	target = ref->target;
+	gc_unlock();
+	return (target);
+}
+
+//!/* Called with the lock held after a mark. References that died are */
+//!/* dropped, so are those cleared because their target did */
+void	gc_weak_clear(void)
+{
+	t_gc_range_list	*weak;
+	t_gc_weak		*ref;
+	size_t			kept;
+	size_t			i;
+
+	weak = &get_gc_finalize()->weak;
+	kept = 0;
+	i = 0;
+	while (i < weak->count)
+	{
+		ref = weak->items[i].start;
+		if (gc_is_marked(ref) && !gc_is_marked(ref->target))
+			ref->target = NULL;
+		if (gc_is_marked(ref) && ref->target)
+			weak->items[kept++] = weak->items[i];
+		i++;
+	}
+	weak->count = kept;
+}
+
+//!/* Both the handles and their targets may have moved */
+void	gc_weak_forward(void)
+{
+	t_gc_range_list	*weak;
+	t_gc_weak		*ref;
+	size_t			i;
+
+	weak = &get_gc_finalize()->weak;
+	i = 0;
+	while (i < weak->count)
+	{
+		ref = gc_compact_forward(weak->items[i].start);
+		weak->items[i].start = ref;
+		ref->target = gc_compact_forward(ref->target);
+		i++;
+	}
+}
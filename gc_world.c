@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_world.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:06:14 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:50:58 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+
+static size_t	signal_threads(int sig)
+{
+	t_gc_thread	*self;
+	t_gc_thread	*thread;
+	size_t		count;
+
+	self = *get_gc_thread_self();
+	count = 0;
+	thread = get_gc_world()->threads;
+	while (thread)
+	{
+		if (thread != self && pthread_kill(thread->id, sig) == 0)
+			count++;
+		thread = thread->next;
+	}
+	return (count);
+}
+
+static void	wait_acks(size_t count)
+{
+	sem_t	*ack;
+
+	ack = &get_gc_world()->ack;
+	while (count > 0)
+	{
+		if (sem_wait(ack) == 0)
+			count--;
+	}
+}
+
+//!/* Called with the lock held; returns once every other thread is parked */
+//!/* The pause events run before the stop and after the restart */
+void	gc_stop_world(void)
+{
+	t_gc_world	*world;
+
+	world = get_gc_world();
+	gc_stats_event(GC_EVENT_PAUSE_BEGIN);
+	world->stop_start = gc_now_ns();
+	if (!world->ready)
+		return ;
+	world->stopped = 1;
+	wait_acks(signal_threads(GC_SIG_SUSPEND));
+}
+
+//!/* Waits for the resume acks so a late one can't satisfy the next stop */
+void	gc_start_world(void)
+{
+	t_gc_world	*world;
+
+	world = get_gc_world();
+	if (world->ready)
+	{
+		world->stopped = 0;
+		wait_acks(signal_threads(GC_SIG_RESTART));
+	}
+	gc_stats_pause(gc_now_ns() - world->stop_start);
+	gc_stats_event(GC_EVENT_PAUSE_END);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gc_world_signal.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:06:14 by akivam            #+#    #+#             */
+/*   Updated: 2026/10/17 23:06:14 by akivam           ###   ########.tr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "internal_collector.h"
+#include <errno.h>
+
+static void	restart_handler(int sig)
+{
+	(void)sig;
+}
+
+//!/* A thread inside the allocation fast path parks once it leaves it */
+static void	suspend_handler(int sig)
+{
+	t_gc_thread	*self;
+	int			saved_errno;
+
+	(void)sig;
+	saved_errno = errno;
+	self = *get_gc_thread_self();
+	if (self && self->in_alloc)
+		self->suspend_pending = 1;
+	else if (self)
+		gc_thread_park(self);
+	errno = saved_errno;
+}
+
+//!/* Registers are spilled in this frame, above stack_ptr, and get scanned */
+void	gc_thread_park(t_gc_thread *self)
+{
+	t_gc_world	*world;
+	sigset_t	wait_mask;
+	sigset_t	old_mask;
+	int			stack_var;
+
+	__builtin_unwind_init();
+	world = get_gc_world();
+	sigemptyset(&wait_mask);
+	sigaddset(&wait_mask, GC_SIG_RESTART);
+	pthread_sigmask(SIG_BLOCK, &wait_mask, &old_mask);
+	self->stack_ptr = &stack_var;
+	sem_post(&world->ack);
+	sigfillset(&wait_mask);
+	sigdelset(&wait_mask, GC_SIG_RESTART);
+	while (world->stopped)
+		sigsuspend(&wait_mask);
+	self->stack_ptr = NULL;
+	pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+	sem_post(&world->ack);
+}
+
+static int	install_handler(int sig, void (*handler)(int), int blocked)
+{
+	struct sigaction	action;
+
+	gc_memset(&action, 0, sizeof(action));
+	action.sa_handler = handler;
+	action.sa_flags = SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	if (blocked)
+		sigaddset(&action.sa_mask, blocked);
+	return (sigaction(sig, &action, NULL) == 0);
+}
+
+//!/* Called with the lock held by the first gc_register_thread */
+int	gc_world_init(void)
+{
+	t_gc_world	*world;
+
+	world = get_gc_world();
+	if (world->ready)
+		return (1);
+	if (sem_init(&world->ack, 0, 0) != 0)
+		return (0);
+	if (!install_handler(GC_SIG_SUSPEND, suspend_handler, GC_SIG_RESTART)
+		|| !install_handler(GC_SIG_RESTART, restart_handler, 0))
+	{
+		sem_destroy(&world->ack);
+		return (0);
+	}
+	world->ready = 1;
+	return (1);
+}
@@ -6,7 +6,7 @@
 /*   By: akivam <akivam@student.42istanbul.com.tr>  +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/17 21:39:34 by akivam            #+#    #+#             */
-/*   Updated: 2025/11/28 20:25:14 by akivam           ###   ########.tr       */
+/*   Updated: 2026/10/17 02:40:52 by akivam           ###   ########.tr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,28 +15,876 @@
 
 # include "garbage_collector.h"
 # include <stdlib.h>
+# include <stdint.h>
+# include <pthread.h>
+# include <semaphore.h>
+# include <signal.h>
 
-t_collecter	**get_gc_head(void);
-void		**get_gc_stack_start(void);
+# define GC_FLAG_INTERIOR 1
+# define GC_FLAG_ATOMIC 2
+# define GC_FLAG_TYPED 4
+# define GC_KIND_COUNT 5
+# define GC_MARK_STACK_MIN 1024
+# define GC_MARK_STACK_MAX 4194304
+# define GC_MARKERS_MAX 64
+# define GC_PAGE_SHIFT 16
+# define GC_PAGE_SIZE 65536
+# define GC_MAP_BITS 16
+# define GC_SMALL_MAX 2048
+# define GC_CLASS_COUNT 26
+# define GC_WORD_BITS 64
+# define GC_CARD_SHIFT 9
+# define GC_CARD_COUNT 128
+# define GC_DEFAULT_MIN_HEAP 4194304
+# define GC_DEFAULT_LARGE_THRESHOLD 131072
+# define GC_SIG_SUSPEND SIGPWR
+# define GC_SIG_RESTART SIGXCPU
+# define GC_SIG_FAULT SIGSEGV
+# define GC_STEP_CHUNK 4096
+# define GC_MEM_INLINE 8
+# define GC_REGION_CHUNK 262144
+# define GC_REGION_MAX 2048
+# define GC_REGION_TAG 0xa5a5a5a5a5a5a500UL
+# define GC_PROFILE_DEPTH 24
+# define GC_PROFILE_SKIP 2
+# define GC_PROFILE_BUCKETS 4096
+# define GC_DUMP_BUFFER 4096
+# define GC_FINALIZE_BATCH 64
+# define GC_OWNER_NONE 0
+# define GC_OWNER_PAGE 1
+# define GC_OWNER_LARGE 2
+# define GC_OWNER_REGION 3
 
-void		gc_collect(void);
+/**
+ //! t_gc_config - Per-collector tuning switches
+ //! @interior_pointers: Treat addresses inside a block as references to it
+ //! @policy: When allocations trigger a collection, see gc_set_policy
+ //! @disable_count: Nesting depth of gc_disable, 0 when triggers are on
+ //! @lazy_sweep: Leave pages unswept after gc_collect, see gc_sweep_step
+ //! @mark_threads: Threads marking in parallel, the collecting one included
+ //! @generational: Keep survivors marked and collect young objects only
+ //! @large_threshold: Blocks this big are mmap'd instead of malloc'd
+ //! @on_event: Callback of gc_set_event_callback, or NULL
+ //! @event_arg: Argument passed to @on_event
+ //! @log: Print one line per collection, set from GC_LOG
+ //! @concurrent: Mark on a background thread, see gc_set_concurrent
+ //! @barrier: Writes are reported by gc_write_barrier, not by page faults
+ //! @compact: Full collections evacuate sparse pages, see gc_set_compaction
+ **/
+typedef struct s_gc_config
+{
+	int					interior_pointers;
+	t_gc_policy			policy;
+	int					disable_count;
+	int					lazy_sweep;
+	size_t				mark_threads;
+	int					generational;
+	size_t				large_threshold;
+	t_gc_event_fn		on_event;
+	void				*event_arg;
+	int					log;
+	int					concurrent;
+	int					barrier;
+	int					compact;
+}						t_gc_config;
+
+/**
+ //! t_gc_index - Address-ordered table of every large block
+ //! @blocks: Headers sorted by address, rebuilt at the start of each mark
+ //! @count: Number of headers in @blocks
+ //! @interior_count: Blocks allocated with GC_FLAG_INTERIOR
+ //! @capacity: Allocated slots in @blocks
+ //! @min: Lowest user data address in the heap
+ //! @max: One past the highest user data byte in the heap
+ //! @valid: 0 when the list changed since the last build
+ **/
+typedef struct s_gc_index
+{
+	t_collecter			**blocks;
+	size_t				count;
+	size_t				interior_count;
+	size_t				capacity;
+	uintptr_t			min;
+	uintptr_t			max;
+	int					valid;
+}						t_gc_index;
+
+/**
+ //! t_gc_grey - A marked object whose contents still have to be scanned
+ //! @start: First byte of the object
+ //! @size: Number of bytes to scan
+ //! @flags: GC_FLAG_* bits of the object, telling how to scan it
+ **/
+typedef struct s_gc_grey
+{
+	void				*start;
+	size_t				size;
+	unsigned char		flags;
+}						t_gc_grey;
+
+/**
+ //! t_gc_mark_stack - One marker's deque of grey objects
+ //! @items: Marked objects whose data has not been scanned yet
+ //! @bottom: Oldest pending object, where other markers steal from
+ //! @top: One past the newest pending object, where the owner works
+ //! @capacity: Allocated slots in @items, at most GC_MARK_STACK_MAX
+ //! @overflowed: Set when a marked object could not be pushed
+ //! @marked_bytes: Bytes this marker marked during the current cycle
+ //! @marked_objects: Objects this marker marked during the current cycle
+ //! @misses: Words this marker looked up without finding an object
+ //! @lock: Spinlock taken by the owner and by thieves
+ **/
+typedef struct s_gc_mark_stack
+{
+	t_gc_grey			*items;
+	size_t				bottom;
+	size_t				top;
+	size_t				capacity;
+	int					overflowed;
+	size_t				marked_bytes;
+	size_t				marked_objects;
+	size_t				misses;
+	int					lock;
+}						t_gc_mark_stack;
+
+/**
+ //! t_gc_range_list - Growable array of memory ranges
+ //! @items: Ranges, each scanned like an object with mark_memory_region
+ //! @count: Ranges in @items
+ //! @capacity: Allocated slots in @items
+ **/
+typedef struct s_gc_range_list
+{
+	t_gc_grey			*items;
+	size_t				count;
+	size_t				capacity;
+}						t_gc_range_list;
+
+/**
+ //! t_gc_roots - Roots outside the thread stacks
+ //! @segments: Writable PT_LOAD segments of every loaded object
+ //! @user: Ranges added with gc_add_root
+ //! @adds: Objects loaded so far, as counted when @segments was built
+ //! @subs: Objects unloaded so far, as counted when @segments was built
+ //! @cached: 1 once @segments matches @adds and @subs
+ **/
+typedef struct s_gc_roots
+{
+	t_gc_range_list		segments;
+	t_gc_range_list		user;
+	unsigned long long	adds;
+	unsigned long long	subs;
+	int					cached;
+}						t_gc_roots;
+
+/**
+ //! t_gc_markers - Helper threads of the parallel mark phase
+ //! @threads: Helper thread ids, index 0 is unused
+ //! @stacks: Deque of each marker, index 0 is the collecting thread's
+ //! @started: Helper threads currently running
+ //! @ready: Helpers that have published their deque
+ //! @generation: Bumped to start each parallel mark
+ //! @finished: Helpers done with the current generation
+ //! @active: Markers that are not looking for work
+ //! @shutdown: Set to make the helpers exit
+ //! @sync: 1 once @mutex and the condition variables are set up
+ //! @mutex: Protects every field above except @active and @sync
+ //! @wake: Signalled on a new generation or on shutdown
+ //! @done: Signalled when a helper is ready or finished
+ **/
+typedef struct s_gc_markers
+{
+	pthread_t			threads[GC_MARKERS_MAX];
+	t_gc_mark_stack		*stacks[GC_MARKERS_MAX];
+	size_t				started;
+	size_t				ready;
+	size_t				generation;
+	size_t				finished;
+	size_t				active;
+	int					shutdown;
+	int					sync;
+	pthread_mutex_t		mutex;
+	pthread_cond_t		wake;
+	pthread_cond_t		done;
+}						t_gc_markers;
+
+/**
+ //! t_gc_page - Side metadata for one GC_PAGE_SIZE page of small objects
+ //! @next: Next page of the same kind and size class
+ //! @base: First object, aligned to GC_PAGE_SIZE
+ //! @obj_size: Size class of every object on the page
+ //! @obj_count: Number of object slots
+ //! @live_count: Slots currently allocated
+ //! @cursor: First bitmap word that may still have a free slot
+ //! @fresh: Slots from this one on were never handed out and hold zeros
+ //! @words: Length of each bitmap in unsigned longs
+ //! @sweep_epoch: Heap epoch of the last sweep, stale while unswept
+ //! @flags: GC_FLAG_* bits shared by every object on the page
+ //! @owner: Thread allocating from the page without the lock, or NULL
+ //! @dirty: Set by gc_write_barrier when any card of the page is dirty
+ //! @pinned: Set during compaction when an ambiguous word points into it
+ //! @moving: Set during compaction while its objects are evacuated; each
+ //!          moved slot then starts with the object's new address
+ //! @mark_bits: One mark bit per slot, kept on old objects when sticky
+ //! @alloc_bits: One bit per allocated slot
+ //! @cards: One byte per 2^GC_CARD_SHIFT bytes, set by gc_write_barrier
+ **/
+typedef struct s_gc_page
+{
+	struct s_gc_page	*next;
+	char				*base;
+	size_t				obj_size;
+	size_t				obj_count;
+	size_t				live_count;
+	size_t				cursor;
+	size_t				fresh;
+	size_t				words;
+	size_t				sweep_epoch;
+	unsigned char		flags;
+	struct s_gc_thread	*owner;
+	unsigned char		dirty;
+	unsigned char		pinned;
+	unsigned char		moving;
+	unsigned long		*mark_bits;
+	unsigned long		*alloc_bits;
+	unsigned char		*cards;
+}						t_gc_page;
+
+typedef size_t			t_gc_word __attribute__((may_alias, aligned(1)));
+
+/**
+ //! t_gc_mem_kernels - Memory primitives picked for this CPU
+ //! @set: Fills n bytes with c
+ //! @copy: Copies n bytes between buffers that don't overlap
+ //! @cmp: Index of the first differing byte, n when there is none
+ //! @chr: Index of the first byte equal to c, n when there is none
+ **/
+typedef struct s_gc_mem_kernels
+{
+	void				(*set)(void *dst, int c, size_t n);
+	void				(*copy)(void *dst, const void *src, size_t n);
+	size_t				(*cmp)(const void *s1, const void *s2, size_t n);
+	size_t				(*chr)(const void *s, int c, size_t n);
+}						t_gc_mem_kernels;
+
+struct	s_gc_filter;
+
+typedef void			(*t_gc_scan_fn)(void **words, size_t count,
+							const struct s_gc_filter *filter);
+
+/**
+ //! t_gc_filter - Cheap test run on every scanned word before the lookup
+ //! @min: Lowest heap address, pages and large blocks alike
+ //! @shift: A word may point into the heap only if (word - @min) >> @shift
+ //!         is 0, which covers the heap rounded up to a power of two
+ //! @align: Low bits that must be clear, 0 when interior pointers exist
+ //! @scan: Scanning kernel picked for this CPU, see gc_filter_update
+ **/
+typedef struct s_gc_filter
+{
+	uintptr_t			min;
+	uintptr_t			shift;
+	uintptr_t			align;
+	t_gc_scan_fn		scan;
+}						t_gc_filter;
+
+/**
+ //! t_gc_region - Allocations between gc_region_begin and gc_region_end
+ //! @next: Next open region of the instance
+ //! @outer: Region the thread had open before this one, if any
+ //! @instance: Instance current when the region began
+ //! @chunks: Mappings bump-allocated from, newest first. Each starts with
+ //!          the header of a mapped block, whose size is the bytes used
+ //! @min: Lowest chunk address, 0 before the first chunk
+ //! @max: One past the highest chunk address
+ //! 
+ //! Note: Every object is preceded by two words: its offset in the chunk,
+ //!       its size and its flags packed in one, then GC_REGION_TAG where a
+ //!       block header keeps a pointer, which tells the two apart.
+ **/
+typedef struct s_gc_region
+{
+	struct s_gc_region		*next;
+	struct s_gc_region		*outer;
+	struct s_gc_instance	*instance;
+	t_collecter				*chunks;
+	uintptr_t				min;
+	uintptr_t				max;
+}							t_gc_region;
+
+/**
+ //! t_gc_site - Call stack that sampled allocations came from
+ //! @next: Next site in the same hash chain
+ //! @id: Number of the site in heap dumps, from 1
+ //! @hash: Hash of @frames
+ //! @depth: Return addresses in @frames
+ //! @frames: Return addresses, innermost first
+ //! @samples: Allocations sampled here so far
+ //! @sampled_bytes: Bytes asked for by those allocations
+ //! @live_samples: Sampled objects from here that survived the last
+ //!                collection
+ //! @live_bytes: Bytes asked for by those objects
+ **/
+typedef struct s_gc_site
+{
+	struct s_gc_site	*next;
+	size_t				id;
+	size_t				hash;
+	size_t				depth;
+	void				*frames[GC_PROFILE_DEPTH];
+	size_t				samples;
+	size_t				sampled_bytes;
+	size_t				live_samples;
+	size_t				live_bytes;
+}						t_gc_site;
+
+/**
+ //! t_gc_sample - An allocation picked by the sampler, kept until it dies
+ //! @next: Next sample in the same hash chain
+ //! @ptr: Object, updated when compaction or mremap moves it
+ //! @size: Bytes asked for
+ //! @site: Where it was allocated
+ **/
+typedef struct s_gc_sample
+{
+	struct s_gc_sample	*next;
+	void				*ptr;
+	size_t				size;
+	t_gc_site			*site;
+}						t_gc_sample;
+
+/**
+ //! t_gc_dump - Buffered writer of gc_dump_heap
+ //! @fd: File descriptor written to
+ //! @ok: Cleared by the first failed write, which ends the dump
+ //! @used: Bytes waiting in @buffer
+ //! @buffer: Output not written yet
+ **/
+typedef struct s_gc_dump
+{
+	int					fd;
+	int					ok;
+	size_t				used;
+	unsigned char		buffer[GC_DUMP_BUFFER];
+}						t_gc_dump;
+
+/**
+ //! t_gc_profile - Sampled allocations of one instance
+ //! @samples: Live samples hashed by address, GC_PROFILE_BUCKETS chains
+ //! @sites: Sites hashed by call stack, GC_PROFILE_BUCKETS chains
+ //! @count: Samples in @samples
+ //! @site_count: Sites in @sites, also the last id handed out
+ //! @dump: Writer of a gc_dump_heap waiting for its collection, or NULL
+ //! 
+ //! Note: Both tables are allocated by the first sample and only change
+ //!       with the lock held.
+ **/
+typedef struct s_gc_profile
+{
+	t_gc_sample			**samples;
+	t_gc_site			**sites;
+	size_t				count;
+	size_t				site_count;
+	t_gc_dump			*dump;
+}						t_gc_profile;
+
+/**
+ //! t_gc_sampler - Countdown of a thread to its next sampled allocation
+ //! @period: Mean interval @left was drawn with, 0 before the first draw
+ //! @left: Bytes the thread may still allocate before the next sample
+ //! @seed: State of the xorshift generator, 0 until it is seeded
+ **/
+typedef struct s_gc_sampler
+{
+	size_t				period;
+	size_t				left;
+	unsigned long		seed;
+}						t_gc_sampler;
+
+/**
+ //! t_gc_weak - Handle behind gc_weak_t, a small atomic object
+ //! @target: Object referred to, NULL once collected. The handle is never
+ //!          scanned, so this doesn't keep it alive
+ **/
+typedef struct s_gc_weak
+{
+	void				*target;
+}						t_gc_weak;
+
+/**
+ //! t_gc_final - An object and the finalizer registered for it
+ //! @ptr: Object passed to @fn
+ //! @fn: Function given to gc_register_finalizer
+ **/
+typedef struct s_gc_final
+{
+	void				*ptr;
+	t_gc_finalizer		fn;
+}						t_gc_final;
+
+/**
+ //! t_gc_final_list - Growable array of finalizers
+ //! @items: Finalizers and their objects
+ //! @count: Entries in @items
+ //! @capacity: Allocated slots in @items
+ **/
+typedef struct s_gc_final_list
+{
+	t_gc_final			*items;
+	size_t				count;
+	size_t				capacity;
+}						t_gc_final_list;
+
+/**
+ //! t_gc_finalize - Weak references and finalizers of one instance
+ //! @weak: Weak references whose target may be alive, each range starting
+ //!        at the handle
+ //! @registered: Finalizers of objects every mark so far reached
+ //! @ready: Finalizers of objects a mark missed, waiting to run. Their
+ //!         objects are roots until then
+ **/
+typedef struct s_gc_finalize
+{
+	t_gc_range_list		weak;
+	t_gc_final_list		registered;
+	t_gc_final_list		ready;
+}						t_gc_finalize;
+
+/**
+ //! t_gc_blocks - Hash set of the large block headers of an instance
+ //! @slots: Open-addressed table, NULL in free slots
+ //! @count: Headers in @slots
+ //! @capacity: Slots in @slots, a power of two, or 0 before the first block
+ **/
+typedef struct s_gc_blocks
+{
+	t_collecter			**slots;
+	size_t				count;
+	size_t				capacity;
+}						t_gc_blocks;
+
+/**
+ //! t_gc_heap - Segregated-fit heap of small objects
+ //! @pages: Pages of each kind and size class
+ //! @last: Tail of each page list, where new pages are appended
+ //! @current: Page that the next allocation of the class starts from
+ //! @map: Two-level page map from address to page
+ //! @min: Lowest page address ever mapped
+ //! @max: One past the highest page address ever mapped
+ //! @live_bytes: Bytes that survived the last sweep, pages and large blocks
+ //! @allocated_bytes: Bytes handed out since the last sweep
+ //! @marked_bytes: Bytes marked by the current or last mark phase
+ //! @page_count: Number of pages in all lists
+ //! @epoch: Bumped by every mark; pages with an older epoch are unswept
+ //! @unswept: Pages still waiting for a lazy sweep
+ //! @sweep_kind: Kind that gc_sweep_step resumes from
+ //! @sweep_class: Size class that gc_sweep_step resumes from
+ //! @sweep_cursor: Page that gc_sweep_step resumes from
+ //! @large_cursor: Link to the next unswept large block, NULL when none
+ //! @minor: The current or last collection traced young objects only
+ //! @sticky: Mark bits outlive the sweep and flag old objects
+ //! @major_live: Bytes that survived the last full collection
+ //! @filter: Word prefilter of the current mark, set up before it starts
+ //! @large_bytes: Memory held by large blocks, headers included
+ //! @regions: Regions open on any thread, scanned as roots
+ //! @blocks: Every linked large block, for gc_owner
+ //! @evacuated: Pages compaction emptied, freed once the world restarts
+ **/
+typedef struct s_gc_heap
+{
+	t_gc_page			*pages[GC_KIND_COUNT][GC_CLASS_COUNT];
+	t_gc_page			*last[GC_KIND_COUNT][GC_CLASS_COUNT];
+	t_gc_page			*current[GC_KIND_COUNT][GC_CLASS_COUNT];
+	t_gc_page			***map;
+	uintptr_t			min;
+	uintptr_t			max;
+	size_t				live_bytes;
+	size_t				allocated_bytes;
+	size_t				marked_bytes;
+	size_t				page_count;
+	size_t				epoch;
+	size_t				unswept;
+	size_t				sweep_kind;
+	size_t				sweep_class;
+	t_gc_page			*sweep_cursor;
+	t_collecter			**large_cursor;
+	int					minor;
+	int					sticky;
+	size_t				major_live;
+	t_gc_filter			filter;
+	size_t				large_bytes;
+	t_gc_region			*regions;
+	t_gc_blocks			blocks;
+	t_gc_page			*evacuated;
+}						t_gc_heap;
+
+/**
+ //! t_gc_thread - A registered mutator thread
+ //! @next: Next registered thread
+ //! @id: Target of the stop-the-world signals
+ //! @stack_base: Stack end farthest from the top, scanned down to @stack_ptr
+ //! @stack_ptr: Stack top saved while the thread is suspended, else NULL
+ //! @in_alloc: Set around the lock-free allocation fast path
+ //! @suspend_pending: Suspend request deferred until the fast path returns
+ //! @allocated: Bytes allocated since the last flush to the heap counters
+ //! @allocs: Allocations by size bucket, folded into the stats on exit
+ //! @tlab: Page each kind and size class allocates from, owned by the thread
+ **/
+typedef struct s_gc_thread
+{
+	struct s_gc_thread		*next;
+	pthread_t				id;
+	void					*stack_base;
+	void					*volatile stack_ptr;
+	volatile sig_atomic_t	in_alloc;
+	volatile sig_atomic_t	suspend_pending;
+	size_t					allocated;
+	size_t					allocs[GC_STATS_BUCKETS];
+	t_gc_page				*tlab[GC_KIND_COUNT][GC_CLASS_COUNT];
+}							t_gc_thread;
+
+/**
+ //! t_gc_world - Registered threads and the stop-the-world handshake
+ //! @threads: Every registered thread, the collecting one included
+ //! @ack: Posted by each thread once suspended and once resumed
+ //! @stopped: Set while the world is stopped
+ //! @ready: 1 once @ack and the signal handlers are installed
+ //! @stop_start: When the world was last stopped, for the pause stats
+ //! @fault_installed: 1 once the write-protection fault handler is in place
+ //! @old_fault: Action found for GC_SIG_FAULT, run for foreign faults
+ **/
+typedef struct s_gc_world
+{
+	t_gc_thread				*threads;
+	sem_t					ack;
+	volatile sig_atomic_t	stopped;
+	int						ready;
+	unsigned long long		stop_start;
+	int						fault_installed;
+	struct sigaction		old_fault;
+}							t_gc_world;
+
+/**
+ //! t_gc_concurrent - State of the mostly-concurrent mark
+ //! @thread: Background thread draining the mark stack during a cycle
+ //! @started: 1 while @thread runs
+ //! @active: A cycle runs: the heap is protected, new blocks start marked
+ //! @incremental: The cycle is marked by gc_collect_step, not by @thread
+ //! @protecting: The cycle tracks writes by write-protecting the heap
+ //! @draining: @thread is marking; cleared once the mark stack is empty
+ //! @shutdown: Set to make @thread exit
+ //! @cycle: Bumped by every cycle, so @thread only ends the one it drained
+ //! @marked_bytes: Bytes marked by the background drain
+ //! @allocated: heap->allocated_bytes when the cycle began
+ //! @start_ns: When the cycle began, for the mark time
+ //! @sync: 1 once @mutex and @wake are set up
+ //! @mutex: Protects @draining, @shutdown and @marked_bytes
+ //! @wake: Signalled when a drain starts or ends, and on shutdown
+ **/
+typedef struct s_gc_concurrent
+{
+	pthread_t				thread;
+	int						started;
+	int						active;
+	int						incremental;
+	int						protecting;
+	int						draining;
+	int						shutdown;
+	size_t					cycle;
+	size_t					marked_bytes;
+	size_t					allocated;
+	unsigned long long		start_ns;
+	int						sync;
+	pthread_mutex_t			mutex;
+	pthread_cond_t			wake;
+}							t_gc_concurrent;
+
+/**
+ //! t_gc_instance - A collector made by gc_create, behind the public gc_t
+ //! @next: Next instance made by gc_create
+ //! @head, @index, @config, @stack, @heap, @shared, @markers, @concurrent,
+ //! @roots, @stats, @profile, @finalize: What the getters of the same
+ //!                                      names return while the instance
+ //!                                      is current; the default instance
+ //!                                      keeps them in function-static
+ //!                                      variables
+ //! 
+ //! Note: Registered threads, the world and the fault handler are shared
+ //!       by every instance, so is the lock. The TLABs of the registered
+ //!       threads belong to the default instance: the others allocate
+ //!       through @shared, under the lock.
+ **/
+typedef struct s_gc_instance
+{
+	struct s_gc_instance	*next;
+	t_collecter				*head;
+	t_gc_index				index;
+	t_gc_config				config;
+	t_gc_mark_stack			stack;
+	t_gc_heap				heap;
+	t_gc_thread				shared;
+	t_gc_markers			markers;
+	t_gc_concurrent			concurrent;
+	t_gc_roots				roots;
+	t_gc_stats				stats;
+	t_gc_profile			profile;
+	t_gc_finalize			finalize;
+}							t_gc_instance;
+
+t_collecter		**get_gc_head(void);
+void			**get_gc_stack_start(void);
+t_gc_index		*get_gc_index(void);
+t_gc_config		*get_gc_config(void);
+t_gc_mark_stack	*get_gc_mark_stack(void);
+t_gc_heap		*get_gc_heap(void);
+t_gc_world		*get_gc_world(void);
+t_gc_thread		**get_gc_thread_self(void);
+t_gc_thread		*get_gc_shared_thread(void);
+t_gc_markers	*get_gc_markers(void);
+t_gc_concurrent	*get_gc_concurrent(void);
+t_gc_mark_stack	**get_gc_marker_self(void);
+t_gc_roots		*get_gc_roots(void);
+int				*get_gc_fresh(void);
+t_gc_stats		*get_gc_stats_state(void);
+t_gc_region		**get_gc_region_self(void);
+t_gc_finalize	*get_gc_finalize(void);
+int				*get_gc_finalizing(void);
+t_gc_profile	*get_gc_profile(void);
+t_gc_sampler	*get_gc_sampler(void);
+size_t			*get_gc_profile_period(void);
+t_gc_instance	**get_gc_current(void);
+t_gc_instance	**get_gc_instances(void);
+t_gc_instance	*gc_instance_switch(t_gc_instance *instance);
+void			gc_instance_release(void);
+
+void			gc_collect(void);
+
+// thread and stop-the-world functions
+void			gc_lock(void);
+int				gc_trylock(void);
+void			gc_unlock(void);
+int				gc_world_init(void);
+void			gc_stop_world(void);
+void			gc_start_world(void);
+void			gc_thread_park(t_gc_thread *self);
+void			gc_thread_release_tlab(t_gc_thread *thread);
 
 // core GC logic functions
-void		gc_mark(void);
-void		gc_sweep(void);
-t_collecter	*get_header_from_ptr(void *ptr);
+void			gc_mark_prepare(void);
+void			gc_mark_publish(size_t marked_bytes);
+void			gc_mark(void);
+void			gc_collect_stw(void);
+void			gc_collect_sweep(unsigned long long mark_ns, int lazy);
+void			gc_sweep(void);
+t_collecter		*get_header_from_ptr(void *ptr);
+size_t			gc_block_size(void *ptr, unsigned char *flags);
+
+// allocation functions
+void			*gc_alloc(size_t size, unsigned char flags);
+void			*gc_alloc_small(size_t size, unsigned char flags);
+void			*gc_page_take_slot(t_gc_page *page);
+t_gc_page		*gc_page_acquire(size_t size_class, unsigned char flags);
+int				gc_policy_admit(size_t size);
+void			*gc_alloc_large(size_t size, unsigned char flags);
+void			gc_large_link(t_collecter *node, size_t size,
+					unsigned char flags);
+size_t			gc_size_class(size_t size);
+size_t			gc_class_size(size_t size_class);
+
+// large object space functions
+size_t			gc_large_length(size_t size);
+size_t			gc_large_footprint(t_collecter *header);
+t_collecter		*gc_large_map(size_t size);
+void			gc_large_free(t_collecter *header);
+size_t			gc_large_capacity(t_collecter *header);
+int				gc_large_resize(void *ptr, size_t size);
+void			*gc_large_reserve(size_t size, unsigned char flags);
+void			*gc_large_remap(void *ptr, size_t size);
+void			gc_large_dirty(t_collecter *node, void *addr);
+void			gc_large_cards_fill(t_collecter *node, int value);
+void			gc_large_cards_resize(t_collecter *node);
+int				gc_large_cards_push(t_collecter *node, int clean);
+
+// page heap functions
+void			*gc_os_map(size_t size);
+void			gc_os_unmap(void *ptr, size_t size);
+t_gc_page		*gc_page_create(size_t size_class, unsigned char flags);
+void			gc_page_destroy(t_gc_page *page);
+int				gc_page_map_set(void *base, size_t size, t_gc_page *page);
+t_gc_page		*gc_page_find(void *ptr);
+void			gc_page_map_release(void);
+int				gc_page_slot(t_gc_page *page, void *ptr, size_t *slot);
+int				gc_owner(void *ptr);
+size_t			gc_blocks_home(t_gc_blocks *set, t_collecter *node);
+void			gc_blocks_add(t_collecter *node);
+t_collecter		*gc_blocks_find(void *ptr);
+void			gc_blocks_remove(t_collecter *node);
+void			gc_blocks_release(void);
+void			gc_heap_for_each_page(void (*fn)(t_gc_page *));
+void			gc_heap_release(void);
+void			gc_heap_rewind(void);
+size_t			gc_page_sweep(t_gc_page *page);
+size_t			gc_sweep_pages(void);
+size_t			gc_sweep_large_blocks(size_t *budget);
+void			gc_sweep_lazy(void);
+void			gc_sweep_finish(void);
+
+// generational functions
+void			gc_generation_begin(void);
+void			gc_generation_end(void);
+void			gc_scan_dirty_cards(void);
+void			gc_scan_card(t_gc_page *page, size_t card);
+void			*gc_region_alloc(size_t size, unsigned char flags);
+int				gc_region_object(void *ptr);
+t_collecter		*gc_region_chunk(void *ptr);
+size_t			gc_region_size(void *ptr, unsigned char *flags);
+void			gc_region_find_refs(t_gc_region *region, void *start,
+					size_t size);
+void			gc_region_find_escapes(t_gc_region *region);
+void			gc_region_scan_heap(t_gc_region *region);
+void			gc_region_scan_roots(void);
+void			gc_region_unmap(t_collecter *chunk);
+void			gc_region_release(void);
+
+// compaction functions
+void			gc_compact(void);
+void			gc_compact_pin(void *start, size_t size);
+void			gc_compact_pin_all(void);
+size_t			gc_compact_reserve(size_t kind, size_t size_class);
+int				gc_compact_select(size_t kind, size_t size_class);
+t_gc_page		*gc_compact_target(t_gc_page *page);
+size_t			gc_compact_class(size_t kind, size_t size_class);
+void			*gc_compact_forward(void *ptr);
+void			gc_compact_fix(void);
+size_t			gc_compact_unlink(size_t kind, size_t size_class);
+void			gc_compact_release(void);
+
+// heap profiler functions
+void			*gc_profile_note(void *ptr, size_t size);
+void			gc_profile_sample(void *ptr, size_t size);
+void			gc_profile_record(void *ptr, size_t size, void **frames,
+					size_t depth);
+size_t			gc_profile_bucket(void *ptr);
+t_gc_sample		**gc_profile_find(void *ptr);
+void			gc_profile_forget(void *ptr);
+void			gc_profile_move(void *old, void *moved);
+void			gc_profile_forward(void);
+void			gc_profile_collect(void);
+void			gc_profile_release(void);
+void			gc_dump_flush(t_gc_dump *dump);
+void			gc_dump_bytes(t_gc_dump *dump, const void *data, size_t size);
+void			gc_dump_word(t_gc_dump *dump, uint64_t word);
+void			gc_dump_sites(t_gc_dump *dump);
+void			gc_dump_objects(void);
+
+// weak reference and finalizer functions
+int				gc_is_marked(void *ptr);
+void			gc_weak_clear(void);
+void			gc_weak_forward(void);
+int				gc_final_list_add(t_gc_final_list *list, void *ptr,
+					t_gc_finalizer fn);
+void			gc_finalize_scan_roots(void);
+void			gc_finalize_collect(void);
+void			gc_finalize_forward(void);
+void			gc_finalize_pending(void);
+void			gc_finalize_release(void);
+
+// concurrent mark functions
+int				gc_concurrent_begin(int background);
+void			gc_concurrent_collect(int wait);
+void			gc_concurrent_finish(void);
+void			gc_concurrent_complete(size_t marked);
+void			gc_concurrent_rescan_block(t_collecter *node);
+int				gc_concurrent_thread_start(void);
+void			gc_concurrent_thread_stop(void);
+void			gc_concurrent_drain_begin(void);
+void			gc_concurrent_drain_wait(void);
+int				gc_concurrent_drained(void);
+int				gc_concurrent_sticky(void);
+int				gc_preclean(unsigned long long deadline);
+int				gc_protect_install(void);
+void			gc_protect_uninstall(void);
+int				gc_protect_claim(void *addr);
+void			gc_protect_heap(int enable);
+size_t			gc_protect_prefix(t_collecter *node);
+
+// heap index functions
+void			gc_index_build(void);
+void			gc_index_release(void);
+t_collecter		*gc_index_find(void *ptr);
 
 // gc_mark helper functions
-int			is_valid_pointer(void *ptr);
-void		mark_memory_region(void *start, size_t size);
-void		mark_pointer(void *ptr);
-void		mark_from_stack(void);
+int				is_valid_pointer(void *ptr);
+void			mark_memory_region(void *start, size_t size);
+void			mark_pointer(void *ptr);
+void			gc_scan_object(void *start, size_t size, unsigned char flags);
+void			mark_from_stack(void);
+void			gc_stacks_for_each(void (*fn)(void *, size_t));
+
+// statistics functions
+unsigned long long	gc_now_ns(void);
+size_t			gc_stats_bucket(size_t size);
+void			gc_stats_heap_grew(void);
+void			gc_stats_fold_thread(t_gc_thread *thread);
+void			gc_stats_mark_done(void);
+void			gc_stats_event(t_gc_event event);
+void			gc_stats_cycle(unsigned long long mark_ns,
+					unsigned long long sweep_ns);
+void			gc_stats_log(const t_gc_stats *stats, int minor);
+void			gc_stats_pause(unsigned long long ns);
+void			gc_stats_release(void);
+
+// word scanning kernels
+void			gc_filter_update(void);
+void			gc_scan_words(void **words, size_t count,
+					const t_gc_filter *filter);
+t_gc_scan_fn	gc_scan_select_simd(void);
+
+// root set functions
+int				gc_range_list_add(t_gc_range_list *list, void *start,
+					size_t size);
+void			gc_roots_refresh(void);
+void			gc_roots_scan(void);
+void			gc_roots_release(void);
+
+// mark stack functions
+void			gc_mark_stack_push(void *start, size_t size,
+					unsigned char flags);
+int				gc_mark_stack_pop(t_gc_grey *grey);
+void			gc_mark_stack_release(void);
+void			gc_mark_drain(void);
+int				gc_mark_drain_until(unsigned long long deadline);
+void			gc_mark_stack_lock(t_gc_mark_stack *stack);
+void			gc_mark_stack_unlock(t_gc_mark_stack *stack);
+int				gc_mark_stack_steal(t_gc_mark_stack *victim, t_gc_grey *grey);
+
+// parallel mark functions
+void			gc_markers_start(void);
+void			gc_markers_stop(void);
+void			gc_mark_work(size_t index);
+size_t			gc_mark_parallel(void);
+
+// memory kernel functions
+const t_gc_mem_kernels	*gc_mem_kernels(void);
+void			gc_mem_set_words(void *dst, int c, size_t n);
+void			gc_mem_copy_words(void *dst, const void *src, size_t n);
+void			gc_mem_copy_words_back(void *dst, const void *src, size_t n);
+size_t			gc_mem_cmp_words(const void *s1, const void *s2, size_t n);
+size_t			gc_mem_chr_words(const void *s, int c, size_t n);
+void			gc_mem_set_sse2(void *dst, int c, size_t n);
+void			gc_mem_copy_sse2(void *dst, const void *src, size_t n);
+size_t			gc_mem_cmp_sse2(const void *s1, const void *s2, size_t n);
+size_t			gc_mem_chr_sse2(const void *s, int c, size_t n);
+void			gc_mem_set_avx2(void *dst, int c, size_t n);
+void			gc_mem_copy_avx2(void *dst, const void *src, size_t n);
+size_t			gc_mem_cmp_avx2(const void *s1, const void *s2, size_t n);
+size_t			gc_mem_chr_avx2(const void *s, int c, size_t n);
 
 // memory manipulation functions
-void		*gc_memcpy(void *dest, const void *src, size_t n);
-int			gc_memcmp(const void *s1, const void *s2, size_t n);
-void		*gc_memchr(const void *s1, int c, size_t n);
-void		*gc_memmove(void *dest, const void *src, size_t n);
-void		*gc_memset(void *s, int c, size_t n);
+void			*gc_memcpy(void *dest, const void *src, size_t n);
+int				gc_memcmp(const void *s1, const void *s2, size_t n);
+void			*gc_memchr(const void *s1, int c, size_t n);
+void			*gc_memmove(void *dest, const void *src, size_t n);
+void			*gc_memset(void *s, int c, size_t n);
 
 #endif